@@ -5,27 +5,145 @@ STL vs EASTL Compilation Benchmark Script
 This script compiles and measures:
 1. Compilation time (primary focus)
 2. Binary size of the resulting executables
+3. Optional phase split (frontend / backend / link) from -fsyntax-only and -c passes
+4. Optional C++20 module variant, timing the BMI build separately from the consumer TU
+5. Peak compiler memory (max RSS of the build's child processes)
+6. Optional runtime cost of the same workloads (fixed sizes and seed, timed per container section),
+   with allocation counts for EASTL and the peak RSS of the process
+7. Optional hardware/software event counts of the compiler and linker processes (perf_event_open)
+8. Optional thread scaling of the runtime workloads (type workloads on 1..all cores, work stealing)
 
-Usage: python3 benchmark.py [--build-type Debug|Release|RelWithDebInfo|MinSizeRel] [--output-format json|table]
+Usage: python3 benchmark.py [--build-type Debug|Release|RelWithDebInfo|MinSizeRel] [--output-format json|table] [--phases] [--cxx20-modules]
+       [--driver ladder|fold|recursive] [--nesting-depth N] [--type-family FAMILY] [--runtime]
+       [--eastl-allocator malloc|arena|pool|tlcache] [--stl-allocator default|pmr_monotonic|pmr_pool] [--perf-counters]
+       [--thread-scaling]
 """
 
 import os
+import sys
 import subprocess
+import tempfile
 import time
 import json
+import shlex
 import argparse
 from pathlib import Path
 import shutil
 
+from perf_counters import PerfCounters, EVENTS as PERF_EVENTS, add_counts
+
+# Build configuration dimensions that multi_benchmark.py --sweep can iterate over.
+# Each value maps to the CMake cache entries it sets on top of the defaults.
+SWEEP_DIMENSIONS = {
+    "driver": {
+        "ladder": {"INSTANTIATION_DRIVER": "ladder"},
+        "fold": {"INSTANTIATION_DRIVER": "fold"},
+        "recursive": {"INSTANTIATION_DRIVER": "recursive"}
+    },
+    "nesting_depth": {
+        str(depth): {"NESTING_DEPTH": depth} for depth in range(0, 5)
+    },
+    "type_family": {
+        family: {"TYPE_FAMILY": family}
+        for family in ["randomized", "regular", "pod", "large_array", "many_fields", "nontrivial_dtor", "overaligned"]
+    },
+    "move_semantics": {
+        mode: {"MOVE_SEMANTICS": mode} for mode in ["copy_only", "noexcept", "throwing"]
+    },
+    "eastl_allocator": {
+        backend: {"EASTL_ALLOCATOR_BACKEND": backend} for backend in ["malloc", "arena", "pool", "tlcache"]
+    },
+    # Matching allocator models for both libraries: std::pmr resources vs the EASTL hook backends
+    "allocator_model": {
+        "default": {"STL_ALLOCATOR": "default", "EASTL_ALLOCATOR_BACKEND": "malloc"},
+        "arena": {"STL_ALLOCATOR": "pmr_monotonic", "EASTL_ALLOCATOR_BACKEND": "arena"},
+        "pool": {"STL_ALLOCATOR": "pmr_pool", "EASTL_ALLOCATOR_BACKEND": "pool"}
+    },
+    # Container checks of both libraries: hardening / assert macros, then the full debug modes
+    "check_level": {
+        level: {"CHECK_LEVEL": level} for level in ["off", "assertions", "debug"]
+    },
+    # C++ exceptions and RTTI of both libraries; "off" is how EASTL ships (-fno-exceptions -fno-rtti)
+    "exceptions_rtti": {
+        "on": {"ENABLE_EXCEPTIONS": "ON", "ENABLE_RTTI": "ON"},
+        "no_rtti": {"ENABLE_EXCEPTIONS": "ON", "ENABLE_RTTI": "OFF"},
+        "no_exceptions": {"ENABLE_EXCEPTIONS": "OFF", "ENABLE_RTTI": "ON"},
+        "off": {"ENABLE_EXCEPTIONS": "OFF", "ENABLE_RTTI": "OFF"}
+    },
+    # Sanitizer builds against the plain one: ASan, UBSan, TSan
+    "sanitizer": {
+        sanitizer: {"SANITIZER": sanitizer} for sanitizer in ["none", "address", "undefined", "thread"]
+    },
+    # Optional workload tracks (tracks.inc); "none" is the plain container workload to compare against
+    "track": {
+        "none": {"BENCHMARK_TRACKS": ""},
+        **{track: {"BENCHMARK_TRACKS": track} for track in ["fixed", "flat", "intrusive", "sort", "string", "hash", "emplace", "traverse"]}
+    }
+}
+
+# ELF sections reported next to the binary size: code, and the unwind tables and exception
+# handler tables that exceptions add (size -A)
+BINARY_SECTIONS = [".text", ".eh_frame", ".eh_frame_hdr", ".gcc_except_table"]
+
+# Per-section runtime metrics reported in the summaries: (key in the section aggregate, title)
+RUNTIME_METRICS = [
+    ("ns_per_element", "ns per element"),
+    ("allocations_per_element", "allocations per element"),
+    ("footprint_per_element", "peak bytes per live element"),
+    ("overhead_per_element", "overhead bytes per live element (footprint - sizeof(T))"),
+    ("constructions_per_element", "element constructions per insert (emplace track)"),
+    ("cache_misses_per_element", "cache misses per element (perf_event_open)"),
+    ("branch_misses_per_element", "branch misses per element (perf_event_open)")
+]
+
+# Metrics that only some sections or machines report; their tables list just the sections that have them
+OPTIONAL_RUNTIME_METRICS = {"constructions_per_element", "cache_misses_per_element", "branch_misses_per_element"}
+
+def run_measured(cmd, cwd=None):
+    """Run a command and return (CompletedProcess, peak RSS in KB of it and its descendants)"""
+    if not hasattr(os, "wait4"):
+        return subprocess.run(cmd, cwd=cwd, capture_output=True, text=True), None
+    
+    # Output goes to temp files so the child can be reaped with wait4, which reports
+    # the max RSS over the child and every descendant it waited for (the compiler)
+    with tempfile.TemporaryFile(mode="w+") as out, tempfile.TemporaryFile(mode="w+") as err:
+        proc = subprocess.Popen(cmd, cwd=cwd, stdout=out, stderr=err, text=True)
+        _, status, rusage = os.wait4(proc.pid, 0)
+        proc.returncode = os.waitstatus_to_exitcode(status)
+        out.seek(0)
+        err.seek(0)
+        result = subprocess.CompletedProcess(cmd, proc.returncode, out.read(), err.read())
+    
+    # ru_maxrss is in bytes on macOS and in kilobytes on Linux
+    peak_kb = rusage.ru_maxrss // 1024 if sys.platform == "darwin" else rusage.ru_maxrss
+    return result, peak_kb
+
 class BenchmarkRunner:
-    def __init__(self, build_dir="build", results_dir="results", build_types=["Debug", "Release"], enable_ftime_trace=True, num_types=100):
+    def __init__(self, build_dir="build", results_dir="results", build_types=["Debug", "Release"], enable_ftime_trace=True, num_types=100, enable_phases=False, enable_modules=False, cmake_options=None, enable_runtime=False, enable_perf_counters=False, enable_thread_scaling=False):
         self.build_dir = Path(build_dir)
         self.results_dir = Path(results_dir)
         self.build_types = build_types if isinstance(build_types, list) else [build_types]
         self.enable_ftime_trace = enable_ftime_trace
         self.num_types = num_types
+        self.enable_phases = enable_phases
+        self.enable_modules = enable_modules
+        self.cmake_options = cmake_options or {}
+        self.enable_runtime = enable_runtime
+        self.enable_thread_scaling = enable_thread_scaling
         self.results = {}
         
+        # Event counters around the compiler and linker processes; skipped where perf_event_open is unavailable
+        self.perf_counters = None
+        if enable_perf_counters:
+            counters = PerfCounters()
+            if counters.available:
+                self.perf_counters = counters
+                missing = [name for name, _, _ in PERF_EVENTS if name not in counters.fds]
+                if missing:
+                    print(f"perf counters unavailable for: {', '.join(missing)}")
+            else:
+                print("perf_event_open counters unavailable, continuing without them")
+        
         # Ensure directories exist
         self.build_dir.mkdir(exist_ok=True)
         self.results_dir.mkdir(exist_ok=True)
@@ -35,6 +153,10 @@ class BenchmarkRunner:
             "compilation_benchmark_test"
         ]
         
+        # C++20 module variant: same source, headers replaced by an imported module
+        if self.enable_modules:
+            self.tests.append("modules_benchmark_test")
+        
         self.libraries = ["stl", "eastl"]
     
     def clean_build(self):
@@ -47,18 +169,27 @@ class BenchmarkRunner:
     def run_cmake(self, build_type):
         """Configure the project with CMake"""
         ftime_trace_status = "enabled" if self.enable_ftime_trace else "disabled"
-        print(f"Configuring with CMake (build type: {build_type}, generator: Ninja, ftime-trace: {ftime_trace_status}, num_types: {self.num_types})...")
+        modules_status = ", cxx20-modules: enabled" if self.enable_modules else ""
+        options_status = "".join(f", {key}: {value}" for key, value in self.cmake_options.items())
+        print(f"Configuring with CMake (build type: {build_type}, generator: Ninja, ftime-trace: {ftime_trace_status}, num_types: {self.num_types}{modules_status}{options_status})...")
         
         cmd = ["cmake", "-S", ".", "-B", str(self.build_dir), 
                f"-DCMAKE_BUILD_TYPE={build_type}", 
                f"-DENABLE_FTIME_TRACE={'ON' if self.enable_ftime_trace else 'OFF'}",
                f"-DNUM_TYPES={self.num_types}",
+               "-DCMAKE_EXPORT_COMPILE_COMMANDS=ON",
+               f"-DENABLE_CXX20_MODULES={'ON' if self.enable_modules else 'OFF'}",
                "-G", "Ninja"]
+        cmd += [f"-D{key}={value}" for key, value in self.cmake_options.items()]
         result = subprocess.run(cmd, capture_output=True, text=True)
         
         if result.returncode != 0:
             print(f"CMake configuration failed: {result.stderr}")
             return False
+        
+        if self.enable_modules and "module variants disabled" in result.stderr:
+            print("C++20 module variants are not supported by this CMake/generator, skipping them")
+            self.tests = [test for test in self.tests if test != "modules_benchmark_test"]
         return True
     
     def compile_target(self, target_name):
@@ -84,16 +215,20 @@ class BenchmarkRunner:
             for trace_file in self.build_dir.glob(trace_pattern):
                 trace_file.unlink()
         
+        # The counters are inherited by the build tool, the compiler and the linker it starts
+        if self.perf_counters:
+            self.perf_counters.start()
         start_time = time.time()
         cmd = ["cmake", "--build", str(self.build_dir), "--target", target_name, "-j1"]
-        result = subprocess.run(cmd, capture_output=True, text=True)
+        result, peak_memory_kb = run_measured(cmd)
         end_time = time.time()
+        perf_counts = self.perf_counters.stop() if self.perf_counters else None
         
         compilation_time = end_time - start_time
         
         if result.returncode != 0:
             print(f"Compilation failed for {target_name}: {result.stderr}")
-            return None, None
+            return None, None, None, None
         
         # Get binary size
         if binary_path.exists():
@@ -102,7 +237,268 @@ class BenchmarkRunner:
             print(f"Binary not found: {binary_path}")
             binary_size = 0
         
-        return compilation_time, binary_size
+        return compilation_time, binary_size, peak_memory_kb, perf_counts
+    
+    def section_sizes(self, target_name):
+        """Sizes of BINARY_SECTIONS in the target's binary from `size -A` (0 when absent), or None without size"""
+        binary_path = self.build_dir / target_name
+        try:
+            result = subprocess.run(["size", "-A", str(binary_path)], capture_output=True, text=True)
+        except FileNotFoundError:
+            return None
+        if result.returncode != 0:
+            return None
+        sizes = {section: 0 for section in BINARY_SECTIONS}
+        for line in result.stdout.splitlines():
+            fields = line.split()
+            if len(fields) >= 2 and fields[0] in sizes and fields[1].isdigit():
+                sizes[fields[0]] = int(fields[1])
+        return sizes
+    
+    def compile_module_interface(self, lib):
+        """Build the module library target alone and time it (BMI build cost)"""
+        target_name = f"{lib}_containers_module"
+        print(f"Compiling module interface {target_name}...")
+        
+        target_obj_dir = self.build_dir / f"CMakeFiles/{target_name}.dir"
+        if target_obj_dir.exists():
+            shutil.rmtree(target_obj_dir)
+        
+        start_time = time.time()
+        cmd = ["cmake", "--build", str(self.build_dir), "--target", target_name, "-j1"]
+        result = subprocess.run(cmd, capture_output=True, text=True)
+        end_time = time.time()
+        
+        if result.returncode != 0:
+            print(f"Module interface build failed for {target_name}: {result.stderr}")
+            return None
+        
+        return end_time - start_time
+    
+    def run_runtime_benchmark(self, lib):
+        """Build and run the runtime variant, aggregating the BENCH lines it prints per section"""
+        target_name = f"{lib}_runtime_benchmark"
+        print(f"Building and running {target_name}...")
+        
+        cmd = ["cmake", "--build", str(self.build_dir), "--target", target_name]
+        result = subprocess.run(cmd, capture_output=True, text=True)
+        if result.returncode != 0:
+            print(f"Runtime benchmark build failed for {target_name}: {result.stderr}")
+            return None
+        
+        result, peak_rss_kb = run_measured([str(self.build_dir / target_name)])
+        if result.returncode != 0:
+            print(f"Runtime benchmark failed for {target_name}: {result.stderr}")
+            return None
+        
+        # One record per (type, section): BENCH {"track", "section", "type", "type_size", "elements", "ns",
+        # "allocations", "bytes", "peak_bytes", "live_elements", "constructions", "cache_misses", "branch_misses"}
+        # The hardware counts are null when perf_event_open is unavailable (see benchmark/perf_counters.h)
+        lines = result.stdout.splitlines()
+        records = [json.loads(line[len("BENCH "):]) for line in lines if line.startswith("BENCH ")]
+        memory = [json.loads(line[len("BENCH_MEMORY "):]) for line in lines if line.startswith("BENCH_MEMORY ")]
+        
+        counters = ["ns", "elements", "allocations", "bytes", "peak_bytes", "live_elements", "constructions"]
+        hardware_counters = ["cache_misses", "branch_misses"]
+        sections = {}
+        for record in records:
+            section = sections.setdefault(f"{record['track']}/{record['section']}",
+                                          {**dict.fromkeys(counters + ["type_bytes"], 0), **dict.fromkeys(hardware_counters)})
+            for counter in counters:
+                section[counter] += record[counter]
+            for counter in hardware_counters:
+                if record.get(counter) is not None:
+                    section[counter] = (section[counter] or 0) + record[counter]
+            section["type_bytes"] += record["type_size"] * record["live_elements"]
+        
+        for section in sections.values():
+            elements, live = section["elements"], section["live_elements"]
+            section["ns_per_element"] = round(section["ns"] / elements, 3) if elements else None
+            section["allocations_per_element"] = round(section["allocations"] / elements, 3) if elements else None
+            # Only the emplace track counts constructions; 1.0 means every element was built in place
+            section["constructions_per_element"] = round(section["constructions"] / elements, 3) if elements and section["constructions"] else None
+            for counter in hardware_counters:
+                section[f"{counter}_per_element"] = round(section[counter] / elements, 4) if elements and section[counter] is not None else None
+            # Footprint: peak live bytes over the elements still held at the end; overhead subtracts the elements themselves
+            section["footprint_per_element"] = round(section["peak_bytes"] / live, 2) if live and section["peak_bytes"] else None
+            section["overhead_per_element"] = round((section["peak_bytes"] - section["type_bytes"]) / live, 2) if live and section["peak_bytes"] else None
+        
+        runtime = {
+            "total_ns": sum(record["ns"] for record in records),
+            "peak_rss_kb": peak_rss_kb,
+            "memory": memory[0] if memory else None,
+            "sections": sections,
+            "records": records
+        }
+        if self.enable_thread_scaling:
+            runtime["scaling"] = self.run_thread_scaling(target_name)
+        return runtime
+    
+    def run_thread_scaling(self, target_name):
+        """Run the runtime variant with the type workloads on 1, 2, 4, .. and all hardware threads.
+        Speedup and efficiency are against the single-threaded wall time; task slowdown compares the
+        summed task times, which grow with contention (allocator locks, memory bandwidth) only"""
+        cores = os.cpu_count() or 1
+        thread_counts = sorted({1, cores} | {1 << i for i in range(cores.bit_length()) if (1 << i) <= cores})
+        
+        scaling = []
+        for threads in thread_counts:
+            result, peak_rss_kb = run_measured([str(self.build_dir / target_name), "--threads", str(threads)])
+            if result.returncode != 0:
+                print(f"Runtime benchmark failed for {target_name} with {threads} threads: {result.stderr}")
+                return None
+            # BENCH_THREADS {"threads", "tasks", "steals", "wall_ns", "busy_ns", "allocations"}
+            lines = [line for line in result.stdout.splitlines() if line.startswith("BENCH_THREADS ")]
+            if not lines:
+                print(f"No BENCH_THREADS line from {target_name}")
+                return None
+            point = json.loads(lines[0][len("BENCH_THREADS "):])
+            point["peak_rss_kb"] = peak_rss_kb
+            scaling.append(point)
+        
+        base = scaling[0]
+        for point in scaling:
+            point["tasks_per_second"] = round(point["tasks"] / (point["wall_ns"] / 1e9), 3) if point["wall_ns"] else None
+            point["allocations_per_second"] = round(point["allocations"] / (point["wall_ns"] / 1e9)) if point["wall_ns"] else None
+            point["speedup"] = round(base["wall_ns"] / point["wall_ns"], 3) if point["wall_ns"] else None
+            point["efficiency"] = round(point["speedup"] / point["threads"], 3) if point["speedup"] else None
+            point["task_slowdown"] = round(point["busy_ns"] / base["busy_ns"], 3) if base["busy_ns"] else None
+        return scaling
+    
+    def get_target_compile_commands(self, target_name):
+        """Return the compile_commands.json entries belonging to a target, as argument lists"""
+        commands_file = self.build_dir / "compile_commands.json"
+        if not commands_file.exists():
+            print(f"compile_commands.json not found in {self.build_dir}")
+            return []
+        
+        with open(commands_file) as f:
+            entries = json.load(f)
+        
+        target_marker = f"CMakeFiles/{target_name}.dir/"
+        commands = []
+        for entry in entries:
+            args = entry["arguments"] if "arguments" in entry else shlex.split(entry["command"])
+            if any(target_marker in arg for arg in args):
+                commands.append((entry["directory"], args))
+        return commands
+    
+    def make_phase_command(self, args, phase, output_dir):
+        """Rewrite a compile command for the syntax-only or object-only pass"""
+        phase_args = []
+        skip_next = False
+        for i, arg in enumerate(args):
+            if skip_next:
+                skip_next = False
+                continue
+            # Drop dependency file generation, Ninja owns those paths
+            if arg in ("-MD", "-MMD"):
+                continue
+            if arg in ("-MT", "-MF", "-MQ"):
+                skip_next = True
+                continue
+            if arg == "-o":
+                skip_next = True
+                if phase == "object_only":
+                    phase_args += ["-o", str(output_dir / Path(args[i + 1]).name)]
+                continue
+            if arg == "-c" and phase == "syntax_only":
+                phase_args.append("-fsyntax-only")
+                continue
+            phase_args.append(arg)
+        return phase_args
+    
+    def get_target_link_command(self, target_name):
+        """Return the target's link command as Ninja runs it (from the build directory), or None"""
+        make_program = "ninja"
+        cache_file = self.build_dir / "CMakeCache.txt"
+        if cache_file.exists():
+            for line in cache_file.read_text().splitlines():
+                if line.startswith("CMAKE_MAKE_PROGRAM:"):
+                    make_program = line.split("=", 1)[1]
+                    break
+        # Commands of the target and everything it depends on, in build order; the link step is last
+        result = subprocess.run([make_program, "-C", str(self.build_dir), "-t", "commands", target_name],
+                                capture_output=True, text=True)
+        if result.returncode != 0:
+            return None
+        commands = [line for line in result.stdout.splitlines() if line.strip()]
+        return commands[-1] if commands else None
+    
+    def measure_phases(self, target_name, full_time):
+        """Time -fsyntax-only and -c passes over the target's sources and the target's link step on
+        its own, and derive the phase split (and the event counts per phase when perf counters are
+        enabled)"""
+        print(f"Measuring compilation phases for {target_name}...")
+        
+        commands = self.get_target_compile_commands(target_name)
+        if not commands:
+            print(f"No compile commands found for {target_name}")
+            return None
+        
+        # Phase outputs go to a scratch directory so the real build tree stays untouched
+        output_dir = self.build_dir / "_phases" / target_name
+        if output_dir.exists():
+            shutil.rmtree(output_dir)
+        output_dir.mkdir(parents=True)
+        
+        phase_times = {}
+        phase_counts = {}
+        for phase in ["syntax_only", "object_only"]:
+            total_time = 0.0
+            if self.perf_counters:
+                self.perf_counters.start()
+            for directory, args in commands:
+                cmd = self.make_phase_command(args, phase, output_dir.resolve())
+                start_time = time.time()
+                result = subprocess.run(cmd, cwd=directory, capture_output=True, text=True)
+                total_time += time.time() - start_time
+                
+                if result.returncode != 0:
+                    if self.perf_counters:
+                        self.perf_counters.stop()
+                    print(f"{phase} pass failed for {target_name}: {result.stderr}")
+                    return None
+            phase_times[phase] = total_time
+            if self.perf_counters:
+                phase_counts[phase] = self.perf_counters.stop()
+        
+        # The link is re-run alone over the objects of the full build: a fresh build also spends time on
+        # the EASTL library and on cmake's regeneration check, which belong to no phase of this target
+        link_command = self.get_target_link_command(target_name)
+        if not link_command:
+            print(f"No link command found for {target_name}")
+            return None
+        if self.perf_counters:
+            self.perf_counters.start()
+        start_time = time.time()
+        result = subprocess.run(link_command, shell=True, cwd=self.build_dir, capture_output=True, text=True)
+        phase_times["link"] = time.time() - start_time
+        if self.perf_counters:
+            phase_counts["link"] = self.perf_counters.stop()
+        if result.returncode != 0:
+            print(f"Link step failed for {target_name}: {result.stderr}")
+            return None
+        
+        syntax_time = phase_times["syntax_only"]
+        object_time = phase_times["object_only"]
+        phases = {
+            "syntax_only_time": round(syntax_time, 3),
+            "object_only_time": round(object_time, 3),
+            "full_build_time": round(full_time, 3),
+            "frontend_time": round(syntax_time, 3),
+            "backend_time": round(max(object_time - syntax_time, 0.0), 3),
+            "link_time": round(phase_times["link"], 3)
+        }
+        # Same split as the times: frontend is the -fsyntax-only pass, backend the rest of the -c pass,
+        # link the link step alone
+        if phase_counts:
+            phases["perf_counters"] = {
+                "frontend": phase_counts["syntax_only"],
+                "backend": add_counts(phase_counts["object_only"], phase_counts["syntax_only"], -1),
+                "link": phase_counts["link"]
+            }
+        return phases
     
     def start_clang_build_analyzer(self):
         """Start Clang Build Analyzer session"""
@@ -244,7 +640,19 @@ class BenchmarkRunner:
                     target_name = f"{lib}_{test}"
                     print(f"Processing {target_name}...")
                     
-                    compilation_time, binary_size = self.compile_target(target_name)
+                    # The BMI is built first so the consumer build below only pays for the importing TU
+                    bmi_time = None
+                    if test == "modules_benchmark_test":
+                        bmi_time = self.compile_module_interface(lib)
+                        if bmi_time is None:
+                            self.results[build_type][test][lib] = {
+                                "compilation_time": None,
+                                "binary_size": None,
+                                "error": "Module interface build failed"
+                            }
+                            continue
+                    
+                    compilation_time, binary_size, peak_memory_kb, perf_counts = self.compile_target(target_name)
                     
                     if compilation_time is not None:
                         # Run Clang Build Analyzer if enabled
@@ -254,19 +662,56 @@ class BenchmarkRunner:
                             "compilation_time": round(compilation_time, 3),
                             "binary_size": binary_size,
                             "binary_size_kb": round(binary_size / 1024, 2),
+                            "peak_memory_kb": peak_memory_kb,
                             "clang_analysis_file": analyzer_output
                         }
                         
                         print(f"  Compilation time: {compilation_time:.3f}s")
                         print(f"  Binary size: {binary_size} bytes ({binary_size/1024:.2f} KB)")
+                        if peak_memory_kb is not None:
+                            print(f"  Peak compiler memory: {peak_memory_kb/1024:.1f} MB")
                         if analyzer_output:
                             print(f"  Clang analysis: {analyzer_output}")
+                        
+                        sections = self.section_sizes(target_name)
+                        if sections:
+                            self.results[build_type][test][lib]["sections"] = sections
+                            print("  Sections: " + ", ".join(f"{name} {size}" for name, size in sections.items()))
+                        
+                        if perf_counts:
+                            self.results[build_type][test][lib]["perf_counters"] = perf_counts
+                            print("  Counters: " + ", ".join(f"{name} {count}" for name, count in perf_counts.items() if count is not None))
+                        
+                        if bmi_time is not None:
+                            self.results[build_type][test][lib]["bmi_time"] = round(bmi_time, 3)
+                            print(f"  BMI build time: {bmi_time:.3f}s (consumer TU: {compilation_time:.3f}s)")
+                        
+                        if self.enable_phases:
+                            phases = self.measure_phases(target_name, compilation_time)
+                            self.results[build_type][test][lib]["phases"] = phases
+                            if phases:
+                                print(f"  Phases: frontend {phases['frontend_time']:.3f}s, "
+                                      f"backend {phases['backend_time']:.3f}s, link {phases['link_time']:.3f}s")
                     else:
                         self.results[build_type][test][lib] = {
                             "compilation_time": None,
                             "binary_size": None,
                             "error": "Compilation failed"
                         }
+            
+            # Runtime cost of the same workloads, kept apart from the per-test compile results
+            if self.enable_runtime:
+                print(f"\n--- Runtime benchmark ({build_type}) ---")
+                runtime_results = self.results.setdefault("runtime", {}).setdefault(build_type, {})
+                for lib in self.libraries:
+                    runtime = self.run_runtime_benchmark(lib)
+                    runtime_results[lib] = runtime if runtime else {"error": "Runtime benchmark failed"}
+                    if runtime:
+                        print(f"  {lib.upper()} total runtime: {runtime['total_ns'] / 1e6:.3f} ms")
+                        if runtime["peak_rss_kb"] is not None:
+                            print(f"  {lib.upper()} peak RSS: {runtime['peak_rss_kb'] / 1024:.1f} MB")
+                        if runtime["memory"]:
+                            print(f"  {lib.upper()} allocations ({runtime['memory']['backend']}): {runtime['memory']['allocations']}")
         
         return True
     
@@ -318,6 +763,25 @@ class BenchmarkRunner:
                         f.write(f"  EASTL: {eastl_time:.3f}s\n")
                         f.write(f"  Ratio: {speedup:.2f}x ({'STL faster' if speedup < 1 else 'EASTL faster'})\n\n")
                     
+                    # Peak compiler memory
+                    stl_memory = stl_data.get("peak_memory_kb")
+                    eastl_memory = eastl_data.get("peak_memory_kb")
+                    
+                    if stl_memory and eastl_memory:
+                        f.write(f"Peak Compiler Memory:\n")
+                        f.write(f"  STL:   {stl_memory/1024:.1f} MB\n")
+                        f.write(f"  EASTL: {eastl_memory/1024:.1f} MB\n")
+                        f.write(f"  Ratio: {stl_memory/eastl_memory:.2f}x\n\n")
+                    
+                    # Module interface (BMI) cost, reported apart from the consumer TU above
+                    stl_bmi = stl_data.get("bmi_time")
+                    eastl_bmi = eastl_data.get("bmi_time")
+                    
+                    if stl_bmi is not None and eastl_bmi is not None:
+                        f.write(f"BMI Build Time:\n")
+                        f.write(f"  STL:   {stl_bmi:.3f}s\n")
+                        f.write(f"  EASTL: {eastl_bmi:.3f}s\n\n")
+                    
                     # Binary size comparison
                     stl_size = stl_data.get("binary_size")
                     eastl_size = eastl_data.get("binary_size")
@@ -329,6 +793,36 @@ class BenchmarkRunner:
                         f.write(f"  EASTL: {eastl_size} bytes ({eastl_size/1024:.2f} KB)\n")
                         f.write(f"  Ratio: {size_ratio:.2f}x ({'STL smaller' if size_ratio < 1 else 'EASTL smaller'})\n\n")
                     
+                    # Code and exception handling sections of the binaries
+                    section_lines = self.section_lines(stl_data, eastl_data)
+                    if section_lines:
+                        for line in section_lines:
+                            f.write(f"{line}\n")
+                        f.write("\n")
+                    
+                    # Phase split (frontend / backend / link)
+                    stl_phases = stl_data.get("phases")
+                    eastl_phases = eastl_data.get("phases")
+                    
+                    if stl_phases and eastl_phases:
+                        f.write(f"Compilation Phases:\n")
+                        for phase in ["frontend", "backend", "link"]:
+                            f.write(f"  {phase.capitalize():<9} STL: {stl_phases[phase + '_time']:.3f}s, EASTL: {eastl_phases[phase + '_time']:.3f}s\n")
+                        f.write("\n")
+                    
+                    # Compiler and linker event counts
+                    counter_lines = self.counter_lines(stl_data, eastl_data)
+                    if counter_lines:
+                        for line in counter_lines:
+                            f.write(f"{line}\n")
+                        f.write("\n")
+                    
+                    f.write("\n")
+                
+                # Runtime metrics per container section
+                if build_type in self.results.get("runtime", {}):
+                    for line in self.runtime_lines(build_type):
+                        f.write(f"{line}\n")
                     f.write("\n")
                 
                 # Comparison between Debug and Release if both are available
@@ -357,6 +851,87 @@ class BenchmarkRunner:
         
         print(f"Summary saved to: {filename}")
     
+    def section_lines(self, stl_data, eastl_data):
+        """Per-section binary sizes STL vs EASTL"""
+        stl_sections = stl_data.get("sections")
+        eastl_sections = eastl_data.get("sections")
+        if not stl_sections or not eastl_sections:
+            return []
+        lines = ["Binary Sections:"]
+        for section in BINARY_SECTIONS:
+            stl_size, eastl_size = stl_sections.get(section, 0), eastl_sections.get(section, 0)
+            ratio = f", Ratio: {stl_size / eastl_size:.2f}x" if eastl_size > 0 else ""
+            lines.append(f"  {section:<18} STL: {stl_size:>10} bytes, EASTL: {eastl_size:>10} bytes{ratio}")
+        return lines
+    
+    def counter_lines(self, stl_data, eastl_data):
+        """Compiler/linker event counts STL vs EASTL (whole build, then per phase when measured)"""
+        stl_counts = stl_data.get("perf_counters")
+        eastl_counts = eastl_data.get("perf_counters")
+        if not stl_counts or not eastl_counts:
+            return []
+        
+        rows = [("build", stl_counts, eastl_counts)]
+        stl_phases = (stl_data.get("phases") or {}).get("perf_counters") or {}
+        eastl_phases = (eastl_data.get("phases") or {}).get("perf_counters") or {}
+        for phase in ["frontend", "backend", "link"]:
+            if stl_phases.get(phase) and eastl_phases.get(phase):
+                rows.append((phase, stl_phases[phase], eastl_phases[phase]))
+        
+        lines = []
+        for scope, stl, eastl in rows:
+            for name, _, _ in PERF_EVENTS:
+                if stl.get(name) is None or eastl.get(name) is None:
+                    continue
+                ratio = f", Ratio: {stl[name] / eastl[name]:.2f}x" if eastl[name] > 0 else ""
+                lines.append(f"  {scope + ' ' + name:<26} STL: {stl[name]:>16,}, EASTL: {eastl[name]:>16,}{ratio}")
+        # Instructions per cycle tells instruction count apart from stalls (cache misses) in the compiler
+        if stl_counts.get("cycles") and eastl_counts.get("cycles") and \
+                stl_counts.get("instructions") is not None and eastl_counts.get("instructions") is not None:
+            lines.append(f"  {'build IPC':<26} STL: {stl_counts['instructions'] / stl_counts['cycles']:>16.2f}, "
+                         f"EASTL: {eastl_counts['instructions'] / eastl_counts['cycles']:>16.2f}")
+        return ["Compiler Counters:"] + lines if lines else []
+    
+    def runtime_lines(self, build_type):
+        """Runtime tables (one per RUNTIME_METRICS entry, STL vs EASTL per section) plus memory lines"""
+        runtime = self.results.get("runtime", {}).get(build_type, {})
+        stl_sections = runtime.get("stl", {}).get("sections", {})
+        eastl_sections = runtime.get("eastl", {}).get("sections", {})
+        
+        lines = []
+        for metric, title in RUNTIME_METRICS:
+            rows = {}
+            for section in sorted(set(stl_sections) | set(eastl_sections)):
+                rows[section] = [sections.get(section, {}).get(metric) for sections in (stl_sections, eastl_sections)]
+            if metric in OPTIONAL_RUNTIME_METRICS:
+                rows = {section: values for section, values in rows.items() if values != [None, None]}
+                if not rows:
+                    continue
+            lines.append(f"RUNTIME ({title})")
+            lines.append("-" * (len(title) + 10))
+            for section, values in rows.items():
+                stl_value, eastl_value = [f"{value:.3f}" if value is not None else "N/A" for value in values]
+                lines.append(f"  {section:<28} STL: {stl_value:>10}, EASTL: {eastl_value:>10}")
+            lines.append("")
+        
+        # Thread scaling: throughput and the per-task slowdown that contention adds
+        for lib, data in runtime.items():
+            if data.get("scaling"):
+                lines.append(f"{lib.upper()} thread scaling ({data['memory']['backend'] if data.get('memory') else 'allocator'}):")
+                for point in data["scaling"]:
+                    lines.append(f"  {point['threads']:>3} threads: {point['tasks_per_second']:>10.2f} tasks/s, speedup {point['speedup']:.2f}x, "
+                                 f"efficiency {point['efficiency']:.2f}, task slowdown {point['task_slowdown']:.2f}x, "
+                                 f"{point['allocations_per_second']} allocations/s, {point['steals']} steals")
+        
+        for lib, data in runtime.items():
+            if data.get("peak_rss_kb") is not None:
+                lines.append(f"{lib.upper()} peak RSS: {data['peak_rss_kb'] / 1024:.1f} MB")
+            memory = data.get("memory")
+            if memory:
+                lines.append(f"{lib.upper()} allocator {memory['backend']}: {memory['allocations']} allocations, "
+                             f"peak live {memory['peak_live_bytes'] / 1048576:.1f} MB, reserved {memory['reserved_bytes'] / 1048576:.1f} MB")
+        return lines
+    
     def print_results(self):
         """Print results to console"""
         print("\n" + "=" * 60)
@@ -392,6 +967,24 @@ class BenchmarkRunner:
                     ratio = stl_time / eastl_time
                     print(f"  Ratio: {ratio:.2f}x ({'STL faster' if ratio < 1 else 'EASTL faster'})")
                 
+                # Print peak compiler memory
+                stl_memory = stl_data.get("peak_memory_kb")
+                eastl_memory = eastl_data.get("peak_memory_kb")
+                
+                if stl_memory and eastl_memory:
+                    print(f"Peak Compiler Memory:")
+                    print(f"  STL:   {stl_memory/1024:.1f} MB")
+                    print(f"  EASTL: {eastl_memory/1024:.1f} MB")
+                
+                # Print BMI build time for the module variant
+                stl_bmi = stl_data.get("bmi_time")
+                eastl_bmi = eastl_data.get("bmi_time")
+                
+                if stl_bmi is not None and eastl_bmi is not None:
+                    print(f"BMI Build Time:")
+                    print(f"  STL:   {stl_bmi}s")
+                    print(f"  EASTL: {eastl_bmi}s")
+                
                 # Print binary sizes
                 stl_size = stl_data.get("binary_size_kb", "N/A")
                 eastl_size = eastl_data.get("binary_size_kb", "N/A")
@@ -403,6 +996,29 @@ class BenchmarkRunner:
                 if isinstance(stl_size, (int, float)) and isinstance(eastl_size, (int, float)) and eastl_size > 0:
                     ratio = stl_size / eastl_size
                     print(f"  Ratio: {ratio:.2f}x ({'STL smaller' if ratio < 1 else 'EASTL smaller'})")
+                
+                # Print code and exception handling sections
+                for line in self.section_lines(stl_data, eastl_data):
+                    print(line)
+                
+                # Print phase split
+                stl_phases = stl_data.get("phases")
+                eastl_phases = eastl_data.get("phases")
+                
+                if stl_phases and eastl_phases:
+                    print(f"Compilation Phases:")
+                    for phase in ["frontend", "backend", "link"]:
+                        print(f"  {phase.capitalize():<9} STL: {stl_phases[phase + '_time']:.3f}s, EASTL: {eastl_phases[phase + '_time']:.3f}s")
+                
+                # Print compiler and linker event counts
+                for line in self.counter_lines(stl_data, eastl_data):
+                    print(line)
+            
+            # Print runtime metrics per container section
+            if build_type in self.results.get("runtime", {}):
+                print()
+                for line in self.runtime_lines(build_type):
+                    print(line)
         
         # Cross-build-type comparison
         if len(self.build_types) > 1:
@@ -441,6 +1057,39 @@ def main():
                        help="Disable -ftime-trace and Clang Build Analyzer (enabled by default)")
     parser.add_argument("--num-types", type=int, default=100,
                        help="Number of types to instantiate in benchmark (default: 100)")
+    parser.add_argument("--phases", action="store_true",
+                       help="Also time -fsyntax-only and -c passes to split frontend, backend and link cost")
+    parser.add_argument("--cxx20-modules", action="store_true",
+                       help="Also build the C++20 module variant (import std / EASTL module wrapper, CMake 3.28+)")
+    parser.add_argument("--driver", choices=list(SWEEP_DIMENSIONS["driver"].keys()), default=None,
+                       help="Instantiation driver used by main() (default: ladder)")
+    parser.add_argument("--nesting-depth", type=int, default=None,
+                       help="Add container-of-container instantiations up to this depth per type (default: 0, off)")
+    parser.add_argument("--type-family", choices=list(SWEEP_DIMENSIONS["type_family"].keys()), default=None,
+                       help="Test type definitions to instantiate (default: randomized)")
+    parser.add_argument("--move-semantics", choices=list(SWEEP_DIMENSIONS["move_semantics"].keys()), default=None,
+                       help="Move operations of the test types (default: copy_only)")
+    parser.add_argument("--runtime", action="store_true",
+                       help="Also build and run the runtime variants and report ns per element per container section")
+    parser.add_argument("--eastl-allocator", choices=list(SWEEP_DIMENSIONS["eastl_allocator"].keys()), default=None,
+                       help="Backend behind the EASTL operator new[] hooks (default: malloc)")
+    parser.add_argument("--stl-allocator", choices=["default", "pmr_monotonic", "pmr_pool"], default=None,
+                       help="STL allocator model: std::allocator or std::pmr containers on a per-section resource (default: default)")
+    parser.add_argument("--check-level", choices=list(SWEEP_DIMENSIONS["check_level"].keys()), default=None,
+                       help="Container checking level of both libraries: off, assertions or debug (default: off)")
+    parser.add_argument("--no-exceptions", action="store_true",
+                       help="Build both libraries with -fno-exceptions (EASTL_EXCEPTIONS_ENABLED=0)")
+    parser.add_argument("--no-rtti", action="store_true",
+                       help="Build both libraries with -fno-rtti")
+    parser.add_argument("--sanitizer", choices=list(SWEEP_DIMENSIONS["sanitizer"].keys()), default=None,
+                       help="Build every target with -fsanitize=address, undefined or thread (default: none)")
+    parser.add_argument("--perf-counters", action="store_true",
+                       help="Count cycles, instructions, cache misses, page faults and context switches of the compiler and linker (Linux perf_event_open)")
+    parser.add_argument("--thread-scaling", action="store_true",
+                       help="With --runtime, also run the type workloads on 1, 2, 4 .. all cores (work stealing) and report scaling")
+    parser.add_argument("--tracks", default=None,
+                       help="Comma-separated workload tracks to add per test type: " +
+                            ", ".join(t for t in SWEEP_DIMENSIONS["track"] if t != "none") + " (default: none)")
     
     args = parser.parse_args()
     
@@ -455,7 +1104,38 @@ def main():
         # Default: run both Debug and Release
         build_types = ["Debug", "Release"]
     
-    runner = BenchmarkRunner(build_types=build_types, enable_ftime_trace=not args.disable_ftime_trace, num_types=args.num_types)
+    # Build configuration dimensions selected on the command line
+    cmake_options = {}
+    if args.driver:
+        cmake_options.update(SWEEP_DIMENSIONS["driver"][args.driver])
+    if args.nesting_depth is not None:
+        cmake_options["NESTING_DEPTH"] = args.nesting_depth
+    if args.type_family:
+        cmake_options.update(SWEEP_DIMENSIONS["type_family"][args.type_family])
+    if args.move_semantics:
+        cmake_options.update(SWEEP_DIMENSIONS["move_semantics"][args.move_semantics])
+    if args.eastl_allocator:
+        cmake_options.update(SWEEP_DIMENSIONS["eastl_allocator"][args.eastl_allocator])
+    if args.stl_allocator:
+        cmake_options["STL_ALLOCATOR"] = args.stl_allocator
+    if args.check_level:
+        cmake_options.update(SWEEP_DIMENSIONS["check_level"][args.check_level])
+    if args.no_exceptions:
+        cmake_options["ENABLE_EXCEPTIONS"] = "OFF"
+    if args.no_rtti:
+        cmake_options["ENABLE_RTTI"] = "OFF"
+    if args.sanitizer:
+        cmake_options.update(SWEEP_DIMENSIONS["sanitizer"][args.sanitizer])
+    if args.tracks:
+        tracks = [t.strip() for t in args.tracks.split(",") if t.strip()]
+        unknown = [t for t in tracks if t not in SWEEP_DIMENSIONS["track"] or t == "none"]
+        if unknown:
+            parser.error(f"unknown track(s): {', '.join(unknown)}")
+        cmake_options["BENCHMARK_TRACKS"] = ";".join(tracks)
+    
+    runner = BenchmarkRunner(build_types=build_types, enable_ftime_trace=not args.disable_ftime_trace, num_types=args.num_types, enable_phases=args.phases,
+                             enable_modules=args.cxx20_modules, cmake_options=cmake_options, enable_runtime=args.runtime,
+                             enable_perf_counters=args.perf_counters, enable_thread_scaling=args.thread_scaling)
     
     if args.clean:
         runner.clean_build()
@@ -0,0 +1,38 @@
+// Allocation counters of the benchmark's allocation hooks: the EASTL operator new[] hooks
+// (eastl_new.cpp) and the STL global operator new/delete replacements (stl_new.cpp)
+// Read by the runtime benchmark to report allocations and footprint per container section
+// Counters are kept per thread: a section runs on one thread, so its deltas stay its own when the
+// type workloads run on several threads (--threads), and worker threads fold theirs into the
+// process totals before they exit
+
+#ifndef ALLOCATION_STATS_H
+#define ALLOCATION_STATS_H
+
+#include <cstddef>
+
+struct AllocationStats {
+    size_t allocations;      // successful allocations so far
+    size_t deallocations;    // frees so far
+    size_t bytes_requested;  // cumulative bytes asked for, excluding headers and padding
+    size_t live_bytes;       // requested bytes not freed yet
+    size_t peak_live_bytes;  // high-water mark of live_bytes
+    size_t reserved_bytes;   // bytes the backend obtained from the system (blocks, chunks, slabs)
+};
+
+// Snapshot of the calling thread's counters since it started (the whole run when single-threaded)
+AllocationStats allocation_stats();
+
+// Counters of the calling thread plus every thread merged so far; peak_live_bytes is the sum of
+// the per-thread peaks, an upper bound of the process peak
+AllocationStats allocation_stats_total();
+
+// Fold the calling thread's counters into the totals (worker threads, right before they exit)
+void allocation_stats_merge_thread();
+
+// Restart the calling thread's peak_live_bytes high-water mark from its live bytes (start of a section)
+void reset_peak_live_bytes();
+
+// Name of the allocator backend behind the hooks (EASTL_ALLOCATOR_BACKEND, "malloc" for STL)
+const char* allocation_backend_name();
+
+#endif
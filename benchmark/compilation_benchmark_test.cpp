@@ -1,5 +1,6 @@
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <ctime>
 
 // Number of types to instantiate (can be defined at compile time)
@@ -7,7 +8,68 @@
 #define NUM_TYPES 100
 #endif
 
+// How main() instantiates the test types; all drivers produce the same instantiations in the same order
+#define DRIVER_LADDER 0     // one #if NUM_TYPES >= N block per type
+#define DRIVER_FOLD 1       // index_sequence fold over TestTypeAt<N>
+#define DRIVER_RECURSIVE 2  // recursive class template over TestTypeAt<N>
+#ifndef INSTANTIATION_DRIVER
+#define INSTANTIATION_DRIVER DRIVER_LADDER
+#endif
+
+// Container-of-container nesting depth per test type (0 disables the nested workload)
+#ifndef NESTING_DEPTH
+#define NESTING_DEPTH 0
+#endif
+
+// Test type family: the two generated families plus hand-picked shapes for the type-shape sweep
+#define TYPE_FAMILY_RANDOMIZED 0       // test_types_randomized.inc
+#define TYPE_FAMILY_REGULAR 1          // test_types.inc (DEFINE_UNIQUE_TYPE)
+#define TYPE_FAMILY_POD 2              // test_types_shapes.inc: trivially copyable
+#define TYPE_FAMILY_LARGE_ARRAY 3      // test_types_shapes.inc: 1-3.4 KB inline arrays
+#define TYPE_FAMILY_MANY_FIELDS 4      // test_types_shapes.inc: 32 scalar fields
+#define TYPE_FAMILY_NONTRIVIAL_DTOR 5  // test_types_shapes.inc: destructor scrubs the payload
+#define TYPE_FAMILY_OVERALIGNED 6      // test_types_shapes.inc: alignas(64)
+#ifndef TYPE_FAMILY
+#define TYPE_FAMILY TYPE_FAMILY_RANDOMIZED
+#endif
+
+// Move operations every test type declares through TEST_TYPE_MOVE_OPERATIONS: none, so the
+// user-declared copy operations suppress the implicit moves and every move is a copy (the
+// original types); defaulted noexcept moves; or defaulted moves that may throw, which vector
+// growth skips in favor of copies (move_if_noexcept) while single inserts still move
+#define MOVE_SEMANTICS_COPY_ONLY 0
+#define MOVE_SEMANTICS_NOEXCEPT 1
+#define MOVE_SEMANTICS_THROWING 2
+#ifndef MOVE_SEMANTICS
+#define MOVE_SEMANTICS MOVE_SEMANTICS_COPY_ONLY
+#endif
+
+#if MOVE_SEMANTICS == MOVE_SEMANTICS_NOEXCEPT
+#define TEST_TYPE_MOVE_OPERATIONS(Type) \
+    Type(Type&&) noexcept = default; \
+    Type& operator=(Type&&) noexcept = default;
+#elif MOVE_SEMANTICS == MOVE_SEMANTICS_THROWING
+#define TEST_TYPE_MOVE_OPERATIONS(Type) \
+    Type(Type&&) noexcept(false) = default; \
+    Type& operator=(Type&&) noexcept(false) = default;
+#else
+#define TEST_TYPE_MOVE_OPERATIONS(Type)
+#endif
+
+// STL allocator model: default allocators, or std::pmr containers on a per-section memory resource
+// (the counterparts of the EASTL arena and pool backends in eastl_new.cpp)
+#define STL_ALLOCATOR_DEFAULT 0        // std::allocator
+#define STL_ALLOCATOR_PMR_MONOTONIC 1  // std::pmr containers on a monotonic_buffer_resource
+#define STL_ALLOCATOR_PMR_POOL 2       // std::pmr containers on an unsynchronized_pool_resource
+#ifndef STL_ALLOCATOR
+#define STL_ALLOCATOR STL_ALLOCATOR_DEFAULT
+#endif
+
 #ifdef USE_STL
+#if USE_CXX_MODULES
+// C++20 module build: `import std;` re-exported when available, otherwise a named module over the same headers
+import stl_containers;
+#else
 #include <vector>
 #include <string>
 #include <list>
@@ -19,7 +81,27 @@
 #include <queue>
 #include <stack>
 #include <algorithm>
+#if INSTANTIATION_DRIVER == DRIVER_FOLD
+#include <utility>
+#endif
+#if STL_ALLOCATOR != STL_ALLOCATOR_DEFAULT
+#include <memory_resource>
+#endif
+#endif
 using namespace std;
+#if STL_ALLOCATOR != STL_ALLOCATOR_DEFAULT
+// Containers default-construct with get_default_resource(), which STL_ALLOCATOR_SCOPE() redirects
+#define STL_NS std::pmr
+#define VECTOR_TYPE pmr::vector
+#define STRING_TYPE pmr::string
+#define LIST_TYPE pmr::list
+#define MAP_TYPE pmr::map
+#define SET_TYPE pmr::set
+#define UNORDERED_MAP_TYPE pmr::unordered_map
+#define UNORDERED_SET_TYPE pmr::unordered_set
+#define DEQUE_TYPE pmr::deque
+#else
+#define STL_NS std
 #define VECTOR_TYPE vector
 #define STRING_TYPE string
 #define LIST_TYPE list
@@ -28,10 +110,15 @@ using namespace std;
 #define UNORDERED_MAP_TYPE unordered_map
 #define UNORDERED_SET_TYPE unordered_set
 #define DEQUE_TYPE deque
+#endif
 #define QUEUE_TYPE queue
 #define STACK_TYPE stack
 #define NAMESPACE_PREFIX std
 #elif USE_EASTL
+#if USE_CXX_MODULES
+// C++20 module build: named module wrapping the EASTL headers below
+import eastl_containers;
+#else
 #include <EASTL/vector.h>
 #include <EASTL/string.h>
 #include <EASTL/list.h>
@@ -44,6 +131,10 @@ using namespace std;
 #include <EASTL/stack.h>
 #include <EASTL/algorithm.h>
 #include <EASTL/sort.h>
+#if INSTANTIATION_DRIVER == DRIVER_FOLD
+#include <EASTL/utility.h>
+#endif
+#endif
 using namespace eastl;
 #define VECTOR_TYPE vector
 #define STRING_TYPE string
@@ -59,7 +150,13 @@ using namespace eastl;
 #endif
 
 // Include test types
+#if TYPE_FAMILY == TYPE_FAMILY_RANDOMIZED
 #include "test_types_randomized.inc"
+#elif TYPE_FAMILY == TYPE_FAMILY_REGULAR
+#include "test_types.inc"
+#else
+#include "test_types_shapes.inc"
+#endif
 
 // Hash functions for custom types (needed for unordered containers)
 #ifdef USE_STL
@@ -949,6 +1046,56 @@ namespace eastl {
 }
 #endif
 
+// Workload hooks: the compile benchmark keeps rand() sizes and printf output, while
+// RUNTIME_BENCHMARK builds use fixed sizes, a fixed seed and timed sections instead
+#ifdef RUNTIME_BENCHMARK
+#include "runtime_support.inc"
+#define WORKLOAD_SIZE() (RUNTIME_ELEMENTS)
+#define WORKLOAD_RANDOM() ((intptr_t)benchmark_random())
+#define REPORT_ELEMENT(...) benchmark_consume(__VA_ARGS__)
+#define BENCH_SECTION(track, name) BenchSection bench_section(track, name, T().id, sizeof(T))
+#define BENCH_GLOBAL_SECTION(track, name, type_size) BenchSection bench_section(track, name, 0, type_size)
+#define BENCH_ELEMENTS(count) bench_section.set_elements(count)  // insert operations, not final size (keys collide by id)
+#define BENCH_LIVE_ELEMENTS(count) bench_section.set_live_elements(count)
+#define BENCH_CONSTRUCTIONS(count) bench_section.set_constructions(count)
+// Type workloads are queued and run by the scheduler after main() has listed them (--threads)
+#define RUN_TYPE_WORKLOAD(T) benchmark_scheduler().add(&force_container_instantiations<T>)
+#else
+#define WORKLOAD_SIZE() rand()
+#define WORKLOAD_RANDOM() rand()
+#define REPORT_ELEMENT(...) printf(__VA_ARGS__)
+// Section names are still evaluated, so kernels that take them as parameters build without -Wunused-parameter
+#define BENCH_SECTION(track, name) (void)(name)
+#define BENCH_GLOBAL_SECTION(track, name, type_size) (void)(name)
+#define BENCH_ELEMENTS(count)
+#define BENCH_LIVE_ELEMENTS(count)
+#define BENCH_CONSTRUCTIONS(count)
+#define RUN_TYPE_WORKLOAD(T) force_container_instantiations<T>()
+#endif
+
+// STL allocator scope: in the std::pmr modes every section gets its own memory resource, installed
+// as the default resource for the containers constructed in it and released with it, the way the
+// EASTL arena rewinds once a section has freed everything
+#if defined(USE_STL) && STL_ALLOCATOR != STL_ALLOCATOR_DEFAULT
+struct DefaultResourceScope {
+    explicit DefaultResourceScope(std::pmr::memory_resource* resource)
+        : previous(std::pmr::set_default_resource(resource)) {}
+    ~DefaultResourceScope() { std::pmr::set_default_resource(previous); }
+    std::pmr::memory_resource* previous;
+};
+#if STL_ALLOCATOR == STL_ALLOCATOR_PMR_MONOTONIC
+#define STL_ALLOCATOR_SCOPE() \
+    std::pmr::monotonic_buffer_resource section_resource; \
+    DefaultResourceScope section_resource_scope(&section_resource)
+#else
+#define STL_ALLOCATOR_SCOPE() \
+    std::pmr::unsynchronized_pool_resource section_resource; \
+    DefaultResourceScope section_resource_scope(&section_resource)
+#endif
+#else
+#define STL_ALLOCATOR_SCOPE()
+#endif
+
 // Macro to force instantiation and prevent optimization
 #define FORCE_INSTANTIATION(container) \
     do { \
@@ -960,660 +1107,845 @@ namespace eastl {
         } \
     } while(0)
 
+#if NESTING_DEPTH > 0
+#include "nested_containers.inc"
+#endif
+
+#ifdef RUNTIME_BENCHMARK
+#include "runtime_kernels.inc"
+#endif
+
+#include "tracks.inc"
+
 // Template function to force container instantiations
 template<typename T>
 void force_container_instantiations() {
 #ifdef USE_STL
     // Vector instantiations with random elements and address printing
-    std::vector<T> vec;
-    for(int i = 0; i < rand(); ++i) {
+    {
+    BENCH_SECTION("containers", "vector");
+    STL_ALLOCATOR_SCOPE();
+    STL_NS::vector<T> vec;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         vec.push_back(T());
     }
     for(auto it = vec.begin(); it != vec.end(); ++it) {
-        printf("Vector element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Vector element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(vec);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(vec.size());
+    }
     
     // Map instantiations with multiple random insertions
-    std::map<T, void*> map_ti;
-    std::map<void*, T> map_it;
-    for(int i = 0; i < rand(); ++i) {
-        map_ti[T()] = (void*)(rand());
-        map_it[(void*)(rand())] = T();
+    {
+    BENCH_SECTION("containers", "map");
+    STL_ALLOCATOR_SCOPE();
+    STL_NS::map<T, void*> map_ti;
+    STL_NS::map<void*, T> map_it;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
+        map_ti[T()] = (void*)(WORKLOAD_RANDOM());
+        map_it[(void*)(WORKLOAD_RANDOM())] = T();
     }
     for(auto it = map_ti.begin(); it != map_ti.end(); ++it) {
-        printf("Map key address: %p, value: %p\n", (void*)&(it->first), it->second);
+        REPORT_ELEMENT("Map key address: %p, value: %p\n", (void*)&(it->first), it->second);
     }
     for(auto it = map_it.begin(); it != map_it.end(); ++it) {
-        printf("Map key: %p, value address: %p\n", it->first, (void*)&(it->second));
+        REPORT_ELEMENT("Map key: %p, value address: %p\n", it->first, (void*)&(it->second));
     }
     FORCE_INSTANTIATION(map_ti);
     FORCE_INSTANTIATION(map_it);
+    BENCH_ELEMENTS(2 * WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(map_ti.size() + map_it.size());
+    }
     
     // Set instantiations with random elements and address printing
-    std::set<T> set_t;
-    for(int i = 0; i < rand(); ++i) {
+    {
+    BENCH_SECTION("containers", "set");
+    STL_ALLOCATOR_SCOPE();
+    STL_NS::set<T> set_t;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         set_t.insert(T());
     }
     for(auto it = set_t.begin(); it != set_t.end(); ++it) {
-        printf("Set element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Set element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(set_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(set_t.size());
+    }
     
     // Unordered map instantiations with multiple random insertions
-    std::unordered_map<T, void*> umap_ti;
-    std::unordered_map<void*, T> umap_it;
-    for(int i = 0; i < rand(); ++i) {
-        umap_ti[T()] = (void*)(rand());
-        umap_it[(void*)(rand())] = T();
+    {
+    BENCH_SECTION("containers", "unordered_map");
+    STL_ALLOCATOR_SCOPE();
+    STL_NS::unordered_map<T, void*> umap_ti;
+    STL_NS::unordered_map<void*, T> umap_it;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
+        umap_ti[T()] = (void*)(WORKLOAD_RANDOM());
+        umap_it[(void*)(WORKLOAD_RANDOM())] = T();
     }
     for(auto it = umap_ti.begin(); it != umap_ti.end(); ++it) {
-        printf("Unordered map key address: %p, value: %p\n", (void*)&(it->first), it->second);
+        REPORT_ELEMENT("Unordered map key address: %p, value: %p\n", (void*)&(it->first), it->second);
     }
     for(auto it = umap_it.begin(); it != umap_it.end(); ++it) {
-        printf("Unordered map key: %p, value address: %p\n", it->first, (void*)&(it->second));
+        REPORT_ELEMENT("Unordered map key: %p, value address: %p\n", it->first, (void*)&(it->second));
     }
     FORCE_INSTANTIATION(umap_ti);
     FORCE_INSTANTIATION(umap_it);
+    BENCH_ELEMENTS(2 * WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(umap_ti.size() + umap_it.size());
+    }
     
     // Unordered set instantiations with random elements and address printing
-    std::unordered_set<T> uset_t;
-    for(int i = 0; i < rand(); ++i) {
+    {
+    BENCH_SECTION("containers", "unordered_set");
+    STL_ALLOCATOR_SCOPE();
+    STL_NS::unordered_set<T> uset_t;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         uset_t.insert(T());
     }
     for(auto it = uset_t.begin(); it != uset_t.end(); ++it) {
-        printf("Unordered set element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Unordered set element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(uset_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(uset_t.size());
+    }
     
     // List instantiations with random elements and address printing
-    std::list<T> list_t;
-    for(int i = 0; i < rand(); ++i) {
+    {
+    BENCH_SECTION("containers", "list");
+    STL_ALLOCATOR_SCOPE();
+    STL_NS::list<T> list_t;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         list_t.push_back(T());
     }
     for(auto it = list_t.begin(); it != list_t.end(); ++it) {
-        printf("List element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("List element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(list_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(list_t.size());
+    }
     
     // Deque instantiations with random elements and address printing
-    std::deque<T> deque_t;
-    for(int i = 0; i < rand(); ++i) {
+    {
+    BENCH_SECTION("containers", "deque");
+    STL_ALLOCATOR_SCOPE();
+    STL_NS::deque<T> deque_t;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         deque_t.push_back(T());
     }
     for(auto it = deque_t.begin(); it != deque_t.end(); ++it) {
-        printf("Deque element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Deque element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(deque_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(deque_t.size());
+    }
     
     // Queue instantiations (adapter) with random elements
-    std::queue<T> queue_t;
-    for(int i = 0; i < rand(); ++i) {
+    {
+    BENCH_SECTION("containers", "queue");
+    STL_ALLOCATOR_SCOPE();
+    std::queue<T, STL_NS::deque<T> > queue_t;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         queue_t.push(T());
     }
-    printf("Queue size: %zu, front address: %p\n", queue_t.size(), (void*)&queue_t.front());
+    REPORT_ELEMENT("Queue size: %zu, front address: %p\n", queue_t.size(), (void*)&queue_t.front());
     volatile void* queue_ref = &queue_t;
     (void)queue_ref;
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(queue_t.size());
+    }
     
     // Stack instantiations (adapter) with random elements
-    std::stack<T> stack_t;
-    for(int i = 0; i < rand(); ++i) {
+    {
+    BENCH_SECTION("containers", "stack");
+    STL_ALLOCATOR_SCOPE();
+    std::stack<T, STL_NS::deque<T> > stack_t;
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         stack_t.push(T());
     }
-    printf("Stack size: %zu, top address: %p\n", stack_t.size(), (void*)&stack_t.top());
+    REPORT_ELEMENT("Stack size: %zu, top address: %p\n", stack_t.size(), (void*)&stack_t.top());
     volatile void* stack_ref = &stack_t;
     (void)stack_ref;
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(stack_t.size());
+    }
 #elif USE_EASTL
     // Vector instantiations with random elements and address printing
+    {
+    BENCH_SECTION("containers", "vector");
     eastl::vector<T> vec;
-    for(int i = 0; i < rand(); ++i) {
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         vec.push_back(T());
     }
     for(auto it = vec.begin(); it != vec.end(); ++it) {
-        printf("Vector element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Vector element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(vec);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(vec.size());
+    }
     
     // Map instantiations with multiple random insertions
+    {
+    BENCH_SECTION("containers", "map");
     eastl::map<T, void*> map_ti;
     eastl::map<void*, T> map_it;
-    for(int i = 0; i < rand(); ++i) {
-        map_ti[T()] = (void*)(rand());
-        map_it[(void*)(rand())] = T();
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
+        map_ti[T()] = (void*)(WORKLOAD_RANDOM());
+        map_it[(void*)(WORKLOAD_RANDOM())] = T();
     }
     for(auto it = map_ti.begin(); it != map_ti.end(); ++it) {
-        printf("Map key address: %p, value: %p\n", (void*)&(it->first), it->second);
+        REPORT_ELEMENT("Map key address: %p, value: %p\n", (void*)&(it->first), it->second);
     }
     for(auto it = map_it.begin(); it != map_it.end(); ++it) {
-        printf("Map key: %p, value address: %p\n", it->first, (void*)&(it->second));
+        REPORT_ELEMENT("Map key: %p, value address: %p\n", it->first, (void*)&(it->second));
     }
     FORCE_INSTANTIATION(map_ti);
     FORCE_INSTANTIATION(map_it);
+    BENCH_ELEMENTS(2 * WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(map_ti.size() + map_it.size());
+    }
     
     // Set instantiations with random elements and address printing
+    {
+    BENCH_SECTION("containers", "set");
     eastl::set<T> set_t;
-    for(int i = 0; i < rand(); ++i) {
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         set_t.insert(T());
     }
     for(auto it = set_t.begin(); it != set_t.end(); ++it) {
-        printf("Set element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Set element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(set_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(set_t.size());
+    }
     
     // Unordered map instantiations with multiple random insertions
+    {
+    BENCH_SECTION("containers", "unordered_map");
     eastl::hash_map<T, void*> umap_ti;
     eastl::hash_map<void*, T> umap_it;
-    for(int i = 0; i < rand(); ++i) {
-        umap_ti[T()] = (void*)(rand());
-        umap_it[(void*)(rand())] = T();
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
+        umap_ti[T()] = (void*)(WORKLOAD_RANDOM());
+        umap_it[(void*)(WORKLOAD_RANDOM())] = T();
     }
     for(auto it = umap_ti.begin(); it != umap_ti.end(); ++it) {
-        printf("Unordered map key address: %p, value: %p\n", (void*)&(it->first), it->second);
+        REPORT_ELEMENT("Unordered map key address: %p, value: %p\n", (void*)&(it->first), it->second);
     }
     for(auto it = umap_it.begin(); it != umap_it.end(); ++it) {
-        printf("Unordered map key: %p, value address: %p\n", it->first, (void*)&(it->second));
+        REPORT_ELEMENT("Unordered map key: %p, value address: %p\n", it->first, (void*)&(it->second));
     }
     FORCE_INSTANTIATION(umap_ti);
     FORCE_INSTANTIATION(umap_it);
+    BENCH_ELEMENTS(2 * WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(umap_ti.size() + umap_it.size());
+    }
     
     // Unordered set instantiations with random elements and address printing
+    {
+    BENCH_SECTION("containers", "unordered_set");
     eastl::hash_set<T> uset_t;
-    for(int i = 0; i < rand(); ++i) {
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         uset_t.insert(T());
     }
     for(auto it = uset_t.begin(); it != uset_t.end(); ++it) {
-        printf("Unordered set element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Unordered set element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(uset_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(uset_t.size());
+    }
     
     // List instantiations with random elements and address printing
+    {
+    BENCH_SECTION("containers", "list");
     eastl::list<T> list_t;
-    for(int i = 0; i < rand(); ++i) {
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         list_t.push_back(T());
     }
     for(auto it = list_t.begin(); it != list_t.end(); ++it) {
-        printf("List element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("List element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(list_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(list_t.size());
+    }
     
     // Deque instantiations with random elements and address printing
+    {
+    BENCH_SECTION("containers", "deque");
     eastl::deque<T> deque_t;
-    for(int i = 0; i < rand(); ++i) {
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         deque_t.push_back(T());
     }
     for(auto it = deque_t.begin(); it != deque_t.end(); ++it) {
-        printf("Deque element address: %p\n", (void*)&(*it));
+        REPORT_ELEMENT("Deque element address: %p\n", (void*)&(*it));
     }
     FORCE_INSTANTIATION(deque_t);
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(deque_t.size());
+    }
     
     // Queue instantiations (adapter) with random elements
+    {
+    BENCH_SECTION("containers", "queue");
     eastl::queue<T> queue_t;
-    for(int i = 0; i < rand(); ++i) {
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         queue_t.push(T());
     }
-    printf("Queue size: %zu, front address: %p\n", queue_t.size(), (void*)&queue_t.front());
+    REPORT_ELEMENT("Queue size: %zu, front address: %p\n", queue_t.size(), (void*)&queue_t.front());
     volatile void* queue_ref = &queue_t;
     (void)queue_ref;
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(queue_t.size());
+    }
     
     // Stack instantiations (adapter) with random elements
+    {
+    BENCH_SECTION("containers", "stack");
     eastl::stack<T> stack_t;
-    for(int i = 0; i < rand(); ++i) {
+    for(int i = 0; i < WORKLOAD_SIZE(); ++i) {
         stack_t.push(T());
     }
-    printf("Stack size: %zu, top address: %p\n", stack_t.size(), (void*)&stack_t.top());
+    REPORT_ELEMENT("Stack size: %zu, top address: %p\n", stack_t.size(), (void*)&stack_t.top());
     volatile void* stack_ref = &stack_t;
     (void)stack_ref;
+    BENCH_ELEMENTS(WORKLOAD_SIZE());
+    BENCH_LIVE_ELEMENTS(stack_t.size());
+    }
+#endif
+
+#if NESTING_DEPTH > 0
+    force_nested_instantiations<T>();
+#endif
+
+    run_tracks<T>();
+
+#ifdef RUNTIME_BENCHMARK
+    run_runtime_kernels<T>();
 #endif
 }
 
-// Macro to conditionally instantiate types based on NUM_TYPES
-#define INSTANTIATE_TYPE_IF_ENABLED(N) \
-    do { \
-        if (NUM_TYPES >= N) { \
-            force_container_instantiations<TestType##N>(); \
-        } \
-    } while(0)
+#if INSTANTIATION_DRIVER != DRIVER_LADDER
+#include "type_registry.inc"
+#endif
+
+#if INSTANTIATION_DRIVER == DRIVER_FOLD
+// Fold driver: one comma fold over TestTypeAt<1>..TestTypeAt<NUM_TYPES>
+template<size_t... Is>
+void instantiate_all_types(NAMESPACE_PREFIX::index_sequence<Is...>) {
+    (RUN_TYPE_WORKLOAD(typename TestTypeAt<int(Is) + 1>::type), ...);
+}
+#elif INSTANTIATION_DRIVER == DRIVER_RECURSIVE
+// Recursive driver: InstantiateTypes<N> instantiates types 1..N-1 first, then TestTypeAt<N>
+template<int N>
+struct InstantiateTypes {
+    static void run() {
+        InstantiateTypes<N - 1>::run();
+        RUN_TYPE_WORKLOAD(typename TestTypeAt<N>::type);
+    }
+};
+
+template<>
+struct InstantiateTypes<0> {
+    static void run() {}
+};
+#endif
 
 // Main function to instantiate all containers with all types
-int main() {
+int main(int argc, char** argv) {
+    // --startup-only exits as soon as main is reached, so startup_benchmark.py times loading alone;
+    // the CLOCK_MONOTONIC time on entry lets it tell time to main apart from process exit
+    for(int i = 1; i < argc; ++i) {
+        if(strcmp(argv[i], "--startup-only") == 0) {
+#if defined(__linux__)
+            timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            printf("STARTUP_MAIN_NS %lld\n", (long long)now.tv_sec * 1000000000LL + now.tv_nsec);
+#endif
+            return 0;
+        }
+    }
+    
+#ifdef RUNTIME_BENCHMARK
+    // --threads N spreads the type workloads over N threads (0: one per hardware thread)
+    unsigned threads = 1;
+    for(int i = 1; i + 1 < argc; ++i) {
+        if(strcmp(argv[i], "--threads") == 0) threads = (unsigned)atoi(argv[i + 1]);
+    }
+    if(threads == 0) threads = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+#if defined(USE_STL) && STL_ALLOCATOR != STL_ALLOCATOR_DEFAULT
+    // The pmr sections install their resource as the process-wide default resource
+    if(threads > 1) {
+        fprintf(stderr, "--threads needs STL_ALLOCATOR default: std::pmr default resources are process-wide\n");
+        return 1;
+    }
+#endif
+    benchmark_seed(RUNTIME_SEED);  // Fixed seed so every run does identical work
+    printf("Starting runtime benchmark with %d types, %d elements per container, %u threads...\n", NUM_TYPES, RUNTIME_ELEMENTS, threads);
+#else
     srand((unsigned int)time(nullptr));  // Initialize random seed
     printf("Starting compilation benchmark test with %d types...\n", NUM_TYPES);
+#endif
     
+#if INSTANTIATION_DRIVER == DRIVER_FOLD
+    instantiate_all_types(NAMESPACE_PREFIX::make_index_sequence<NUM_TYPES>());
+#elif INSTANTIATION_DRIVER == DRIVER_RECURSIVE
+    InstantiateTypes<NUM_TYPES>::run();
+#else
     // Force instantiation of all containers with types 1-10 (always enabled)
-    force_container_instantiations<TestType1>();
-    force_container_instantiations<TestType2>();
-    force_container_instantiations<TestType3>();
-    force_container_instantiations<TestType4>();
-    force_container_instantiations<TestType5>();
-    force_container_instantiations<TestType6>();
-    force_container_instantiations<TestType7>();
-    force_container_instantiations<TestType8>();
-    force_container_instantiations<TestType9>();
-    force_container_instantiations<TestType10>();
+    RUN_TYPE_WORKLOAD(TestType1);
+    RUN_TYPE_WORKLOAD(TestType2);
+    RUN_TYPE_WORKLOAD(TestType3);
+    RUN_TYPE_WORKLOAD(TestType4);
+    RUN_TYPE_WORKLOAD(TestType5);
+    RUN_TYPE_WORKLOAD(TestType6);
+    RUN_TYPE_WORKLOAD(TestType7);
+    RUN_TYPE_WORKLOAD(TestType8);
+    RUN_TYPE_WORKLOAD(TestType9);
+    RUN_TYPE_WORKLOAD(TestType10);
     
     // Conditionally instantiate types 11 to 150 based on NUM_TYPES
     #if NUM_TYPES >= 11
-    force_container_instantiations<TestType11>();
+    RUN_TYPE_WORKLOAD(TestType11);
     #endif
     #if NUM_TYPES >= 12
-    force_container_instantiations<TestType12>();
+    RUN_TYPE_WORKLOAD(TestType12);
     #endif
     #if NUM_TYPES >= 13
-    force_container_instantiations<TestType13>();
+    RUN_TYPE_WORKLOAD(TestType13);
     #endif
     #if NUM_TYPES >= 14
-    force_container_instantiations<TestType14>();
+    RUN_TYPE_WORKLOAD(TestType14);
     #endif
     #if NUM_TYPES >= 15
-    force_container_instantiations<TestType15>();
+    RUN_TYPE_WORKLOAD(TestType15);
     #endif
     #if NUM_TYPES >= 16
-    force_container_instantiations<TestType16>();
+    RUN_TYPE_WORKLOAD(TestType16);
     #endif
     #if NUM_TYPES >= 17
-    force_container_instantiations<TestType17>();
+    RUN_TYPE_WORKLOAD(TestType17);
     #endif
     #if NUM_TYPES >= 18
-    force_container_instantiations<TestType18>();
+    RUN_TYPE_WORKLOAD(TestType18);
     #endif
     #if NUM_TYPES >= 19
-    force_container_instantiations<TestType19>();
+    RUN_TYPE_WORKLOAD(TestType19);
     #endif
     #if NUM_TYPES >= 20
-    force_container_instantiations<TestType20>();
+    RUN_TYPE_WORKLOAD(TestType20);
     #endif
     #if NUM_TYPES >= 21
-    force_container_instantiations<TestType21>();
+    RUN_TYPE_WORKLOAD(TestType21);
     #endif
     #if NUM_TYPES >= 22
-    force_container_instantiations<TestType22>();
+    RUN_TYPE_WORKLOAD(TestType22);
     #endif
     #if NUM_TYPES >= 23
-    force_container_instantiations<TestType23>();
+    RUN_TYPE_WORKLOAD(TestType23);
     #endif
     #if NUM_TYPES >= 24
-    force_container_instantiations<TestType24>();
+    RUN_TYPE_WORKLOAD(TestType24);
     #endif
     #if NUM_TYPES >= 25
-    force_container_instantiations<TestType25>();
+    RUN_TYPE_WORKLOAD(TestType25);
     #endif
     #if NUM_TYPES >= 26
-    force_container_instantiations<TestType26>();
+    RUN_TYPE_WORKLOAD(TestType26);
     #endif
     #if NUM_TYPES >= 27
-    force_container_instantiations<TestType27>();
+    RUN_TYPE_WORKLOAD(TestType27);
     #endif
     #if NUM_TYPES >= 28
-    force_container_instantiations<TestType28>();
+    RUN_TYPE_WORKLOAD(TestType28);
     #endif
     #if NUM_TYPES >= 29
-    force_container_instantiations<TestType29>();
+    RUN_TYPE_WORKLOAD(TestType29);
     #endif
     #if NUM_TYPES >= 30
-    force_container_instantiations<TestType30>();
+    RUN_TYPE_WORKLOAD(TestType30);
     #endif
     #if NUM_TYPES >= 31
-    force_container_instantiations<TestType31>();
+    RUN_TYPE_WORKLOAD(TestType31);
     #endif
     #if NUM_TYPES >= 32
-    force_container_instantiations<TestType32>();
+    RUN_TYPE_WORKLOAD(TestType32);
     #endif
     #if NUM_TYPES >= 33
-    force_container_instantiations<TestType33>();
+    RUN_TYPE_WORKLOAD(TestType33);
     #endif
     #if NUM_TYPES >= 34
-    force_container_instantiations<TestType34>();
+    RUN_TYPE_WORKLOAD(TestType34);
     #endif
     #if NUM_TYPES >= 35
-    force_container_instantiations<TestType35>();
+    RUN_TYPE_WORKLOAD(TestType35);
     #endif
     #if NUM_TYPES >= 36
-    force_container_instantiations<TestType36>();
+    RUN_TYPE_WORKLOAD(TestType36);
     #endif
     #if NUM_TYPES >= 37
-    force_container_instantiations<TestType37>();
+    RUN_TYPE_WORKLOAD(TestType37);
     #endif
     #if NUM_TYPES >= 38
-    force_container_instantiations<TestType38>();
+    RUN_TYPE_WORKLOAD(TestType38);
     #endif
     #if NUM_TYPES >= 39
-    force_container_instantiations<TestType39>();
+    RUN_TYPE_WORKLOAD(TestType39);
     #endif
     #if NUM_TYPES >= 40
-    force_container_instantiations<TestType40>();
+    RUN_TYPE_WORKLOAD(TestType40);
     #endif
     #if NUM_TYPES >= 41
-    force_container_instantiations<TestType41>();
+    RUN_TYPE_WORKLOAD(TestType41);
     #endif
     #if NUM_TYPES >= 42
-    force_container_instantiations<TestType42>();
+    RUN_TYPE_WORKLOAD(TestType42);
     #endif
     #if NUM_TYPES >= 43
-    force_container_instantiations<TestType43>();
+    RUN_TYPE_WORKLOAD(TestType43);
     #endif
     #if NUM_TYPES >= 44
-    force_container_instantiations<TestType44>();
+    RUN_TYPE_WORKLOAD(TestType44);
     #endif
     #if NUM_TYPES >= 45
-    force_container_instantiations<TestType45>();
+    RUN_TYPE_WORKLOAD(TestType45);
     #endif
     #if NUM_TYPES >= 46
-    force_container_instantiations<TestType46>();
+    RUN_TYPE_WORKLOAD(TestType46);
     #endif
     #if NUM_TYPES >= 47
-    force_container_instantiations<TestType47>();
+    RUN_TYPE_WORKLOAD(TestType47);
     #endif
     #if NUM_TYPES >= 48
-    force_container_instantiations<TestType48>();
+    RUN_TYPE_WORKLOAD(TestType48);
     #endif
     #if NUM_TYPES >= 49
-    force_container_instantiations<TestType49>();
+    RUN_TYPE_WORKLOAD(TestType49);
     #endif
     #if NUM_TYPES >= 50
-    force_container_instantiations<TestType50>();
+    RUN_TYPE_WORKLOAD(TestType50);
     #endif
     #if NUM_TYPES >= 51
-    force_container_instantiations<TestType51>();
+    RUN_TYPE_WORKLOAD(TestType51);
     #endif
     #if NUM_TYPES >= 52
-    force_container_instantiations<TestType52>();
+    RUN_TYPE_WORKLOAD(TestType52);
     #endif
     #if NUM_TYPES >= 53
-    force_container_instantiations<TestType53>();
+    RUN_TYPE_WORKLOAD(TestType53);
     #endif
     #if NUM_TYPES >= 54
-    force_container_instantiations<TestType54>();
+    RUN_TYPE_WORKLOAD(TestType54);
     #endif
     #if NUM_TYPES >= 55
-    force_container_instantiations<TestType55>();
+    RUN_TYPE_WORKLOAD(TestType55);
     #endif
     #if NUM_TYPES >= 56
-    force_container_instantiations<TestType56>();
+    RUN_TYPE_WORKLOAD(TestType56);
     #endif
     #if NUM_TYPES >= 57
-    force_container_instantiations<TestType57>();
+    RUN_TYPE_WORKLOAD(TestType57);
     #endif
     #if NUM_TYPES >= 58
-    force_container_instantiations<TestType58>();
+    RUN_TYPE_WORKLOAD(TestType58);
     #endif
     #if NUM_TYPES >= 59
-    force_container_instantiations<TestType59>();
+    RUN_TYPE_WORKLOAD(TestType59);
     #endif
     #if NUM_TYPES >= 60
-    force_container_instantiations<TestType60>();
+    RUN_TYPE_WORKLOAD(TestType60);
     #endif
     #if NUM_TYPES >= 61
-    force_container_instantiations<TestType61>();
+    RUN_TYPE_WORKLOAD(TestType61);
     #endif
     #if NUM_TYPES >= 62
-    force_container_instantiations<TestType62>();
+    RUN_TYPE_WORKLOAD(TestType62);
     #endif
     #if NUM_TYPES >= 63
-    force_container_instantiations<TestType63>();
+    RUN_TYPE_WORKLOAD(TestType63);
     #endif
     #if NUM_TYPES >= 64
-    force_container_instantiations<TestType64>();
+    RUN_TYPE_WORKLOAD(TestType64);
     #endif
     #if NUM_TYPES >= 65
-    force_container_instantiations<TestType65>();
+    RUN_TYPE_WORKLOAD(TestType65);
     #endif
     #if NUM_TYPES >= 66
-    force_container_instantiations<TestType66>();
+    RUN_TYPE_WORKLOAD(TestType66);
     #endif
     #if NUM_TYPES >= 67
-    force_container_instantiations<TestType67>();
+    RUN_TYPE_WORKLOAD(TestType67);
     #endif
     #if NUM_TYPES >= 68
-    force_container_instantiations<TestType68>();
+    RUN_TYPE_WORKLOAD(TestType68);
     #endif
     #if NUM_TYPES >= 69
-    force_container_instantiations<TestType69>();
+    RUN_TYPE_WORKLOAD(TestType69);
     #endif
     #if NUM_TYPES >= 70
-    force_container_instantiations<TestType70>();
+    RUN_TYPE_WORKLOAD(TestType70);
     #endif
     #if NUM_TYPES >= 71
-    force_container_instantiations<TestType71>();
+    RUN_TYPE_WORKLOAD(TestType71);
     #endif
     #if NUM_TYPES >= 72
-    force_container_instantiations<TestType72>();
+    RUN_TYPE_WORKLOAD(TestType72);
     #endif
     #if NUM_TYPES >= 73
-    force_container_instantiations<TestType73>();
+    RUN_TYPE_WORKLOAD(TestType73);
     #endif
     #if NUM_TYPES >= 74
-    force_container_instantiations<TestType74>();
+    RUN_TYPE_WORKLOAD(TestType74);
     #endif
     #if NUM_TYPES >= 75
-    force_container_instantiations<TestType75>();
+    RUN_TYPE_WORKLOAD(TestType75);
     #endif
     #if NUM_TYPES >= 76
-    force_container_instantiations<TestType76>();
+    RUN_TYPE_WORKLOAD(TestType76);
     #endif
     #if NUM_TYPES >= 77
-    force_container_instantiations<TestType77>();
+    RUN_TYPE_WORKLOAD(TestType77);
     #endif
     #if NUM_TYPES >= 78
-    force_container_instantiations<TestType78>();
+    RUN_TYPE_WORKLOAD(TestType78);
     #endif
     #if NUM_TYPES >= 79
-    force_container_instantiations<TestType79>();
+    RUN_TYPE_WORKLOAD(TestType79);
     #endif
     #if NUM_TYPES >= 80
-    force_container_instantiations<TestType80>();
+    RUN_TYPE_WORKLOAD(TestType80);
     #endif
     #if NUM_TYPES >= 81
-    force_container_instantiations<TestType81>();
+    RUN_TYPE_WORKLOAD(TestType81);
     #endif
     #if NUM_TYPES >= 82
-    force_container_instantiations<TestType82>();
+    RUN_TYPE_WORKLOAD(TestType82);
     #endif
     #if NUM_TYPES >= 83
-    force_container_instantiations<TestType83>();
+    RUN_TYPE_WORKLOAD(TestType83);
     #endif
     #if NUM_TYPES >= 84
-    force_container_instantiations<TestType84>();
+    RUN_TYPE_WORKLOAD(TestType84);
     #endif
     #if NUM_TYPES >= 85
-    force_container_instantiations<TestType85>();
+    RUN_TYPE_WORKLOAD(TestType85);
     #endif
     #if NUM_TYPES >= 86
-    force_container_instantiations<TestType86>();
+    RUN_TYPE_WORKLOAD(TestType86);
     #endif
     #if NUM_TYPES >= 87
-    force_container_instantiations<TestType87>();
+    RUN_TYPE_WORKLOAD(TestType87);
     #endif
     #if NUM_TYPES >= 88
-    force_container_instantiations<TestType88>();
+    RUN_TYPE_WORKLOAD(TestType88);
     #endif
     #if NUM_TYPES >= 89
-    force_container_instantiations<TestType89>();
+    RUN_TYPE_WORKLOAD(TestType89);
     #endif
     #if NUM_TYPES >= 90
-    force_container_instantiations<TestType90>();
+    RUN_TYPE_WORKLOAD(TestType90);
     #endif
     #if NUM_TYPES >= 91
-    force_container_instantiations<TestType91>();
+    RUN_TYPE_WORKLOAD(TestType91);
     #endif
     #if NUM_TYPES >= 92
-    force_container_instantiations<TestType92>();
+    RUN_TYPE_WORKLOAD(TestType92);
     #endif
     #if NUM_TYPES >= 93
-    force_container_instantiations<TestType93>();
+    RUN_TYPE_WORKLOAD(TestType93);
     #endif
     #if NUM_TYPES >= 94
-    force_container_instantiations<TestType94>();
+    RUN_TYPE_WORKLOAD(TestType94);
     #endif
     #if NUM_TYPES >= 95
-    force_container_instantiations<TestType95>();
+    RUN_TYPE_WORKLOAD(TestType95);
     #endif
     #if NUM_TYPES >= 96
-    force_container_instantiations<TestType96>();
+    RUN_TYPE_WORKLOAD(TestType96);
     #endif
     #if NUM_TYPES >= 97
-    force_container_instantiations<TestType97>();
+    RUN_TYPE_WORKLOAD(TestType97);
     #endif
     #if NUM_TYPES >= 98
-    force_container_instantiations<TestType98>();
+    RUN_TYPE_WORKLOAD(TestType98);
     #endif
     #if NUM_TYPES >= 99
-    force_container_instantiations<TestType99>();
+    RUN_TYPE_WORKLOAD(TestType99);
     #endif
     #if NUM_TYPES >= 100
-    force_container_instantiations<TestType100>();
+    RUN_TYPE_WORKLOAD(TestType100);
     #endif
     #if NUM_TYPES >= 101
-    force_container_instantiations<TestType101>();
+    RUN_TYPE_WORKLOAD(TestType101);
     #endif
     #if NUM_TYPES >= 102
-    force_container_instantiations<TestType102>();
+    RUN_TYPE_WORKLOAD(TestType102);
     #endif
     #if NUM_TYPES >= 103
-    force_container_instantiations<TestType103>();
+    RUN_TYPE_WORKLOAD(TestType103);
     #endif
     #if NUM_TYPES >= 104
-    force_container_instantiations<TestType104>();
+    RUN_TYPE_WORKLOAD(TestType104);
     #endif
     #if NUM_TYPES >= 105
-    force_container_instantiations<TestType105>();
+    RUN_TYPE_WORKLOAD(TestType105);
     #endif
     #if NUM_TYPES >= 106
-    force_container_instantiations<TestType106>();
+    RUN_TYPE_WORKLOAD(TestType106);
     #endif
     #if NUM_TYPES >= 107
-    force_container_instantiations<TestType107>();
+    RUN_TYPE_WORKLOAD(TestType107);
     #endif
     #if NUM_TYPES >= 108
-    force_container_instantiations<TestType108>();
+    RUN_TYPE_WORKLOAD(TestType108);
     #endif
     #if NUM_TYPES >= 109
-    force_container_instantiations<TestType109>();
+    RUN_TYPE_WORKLOAD(TestType109);
     #endif
     #if NUM_TYPES >= 110
-    force_container_instantiations<TestType110>();
+    RUN_TYPE_WORKLOAD(TestType110);
     #endif
     #if NUM_TYPES >= 111
-    force_container_instantiations<TestType111>();
+    RUN_TYPE_WORKLOAD(TestType111);
     #endif
     #if NUM_TYPES >= 112
-    force_container_instantiations<TestType112>();
+    RUN_TYPE_WORKLOAD(TestType112);
     #endif
     #if NUM_TYPES >= 113
-    force_container_instantiations<TestType113>();
+    RUN_TYPE_WORKLOAD(TestType113);
     #endif
     #if NUM_TYPES >= 114
-    force_container_instantiations<TestType114>();
+    RUN_TYPE_WORKLOAD(TestType114);
     #endif
     #if NUM_TYPES >= 115
-    force_container_instantiations<TestType115>();
+    RUN_TYPE_WORKLOAD(TestType115);
     #endif
     #if NUM_TYPES >= 116
-    force_container_instantiations<TestType116>();
+    RUN_TYPE_WORKLOAD(TestType116);
     #endif
     #if NUM_TYPES >= 117
-    force_container_instantiations<TestType117>();
+    RUN_TYPE_WORKLOAD(TestType117);
     #endif
     #if NUM_TYPES >= 118
-    force_container_instantiations<TestType118>();
+    RUN_TYPE_WORKLOAD(TestType118);
     #endif
     #if NUM_TYPES >= 119
-    force_container_instantiations<TestType119>();
+    RUN_TYPE_WORKLOAD(TestType119);
     #endif
     #if NUM_TYPES >= 120
-    force_container_instantiations<TestType120>();
+    RUN_TYPE_WORKLOAD(TestType120);
     #endif
     #if NUM_TYPES >= 121
-    force_container_instantiations<TestType121>();
+    RUN_TYPE_WORKLOAD(TestType121);
     #endif
     #if NUM_TYPES >= 122
-    force_container_instantiations<TestType122>();
+    RUN_TYPE_WORKLOAD(TestType122);
     #endif
     #if NUM_TYPES >= 123
-    force_container_instantiations<TestType123>();
+    RUN_TYPE_WORKLOAD(TestType123);
     #endif
     #if NUM_TYPES >= 124
-    force_container_instantiations<TestType124>();
+    RUN_TYPE_WORKLOAD(TestType124);
     #endif
     #if NUM_TYPES >= 125
-    force_container_instantiations<TestType125>();
+    RUN_TYPE_WORKLOAD(TestType125);
     #endif
     #if NUM_TYPES >= 126
-    force_container_instantiations<TestType126>();
+    RUN_TYPE_WORKLOAD(TestType126);
     #endif
     #if NUM_TYPES >= 127
-    force_container_instantiations<TestType127>();
+    RUN_TYPE_WORKLOAD(TestType127);
     #endif
     #if NUM_TYPES >= 128
-    force_container_instantiations<TestType128>();
+    RUN_TYPE_WORKLOAD(TestType128);
     #endif
     #if NUM_TYPES >= 129
-    force_container_instantiations<TestType129>();
+    RUN_TYPE_WORKLOAD(TestType129);
     #endif
     #if NUM_TYPES >= 130
-    force_container_instantiations<TestType130>();
+    RUN_TYPE_WORKLOAD(TestType130);
     #endif
     #if NUM_TYPES >= 131
-    force_container_instantiations<TestType131>();
+    RUN_TYPE_WORKLOAD(TestType131);
     #endif
     #if NUM_TYPES >= 132
-    force_container_instantiations<TestType132>();
+    RUN_TYPE_WORKLOAD(TestType132);
     #endif
     #if NUM_TYPES >= 133
-    force_container_instantiations<TestType133>();
+    RUN_TYPE_WORKLOAD(TestType133);
     #endif
     #if NUM_TYPES >= 134
-    force_container_instantiations<TestType134>();
+    RUN_TYPE_WORKLOAD(TestType134);
     #endif
     #if NUM_TYPES >= 135
-    force_container_instantiations<TestType135>();
+    RUN_TYPE_WORKLOAD(TestType135);
     #endif
     #if NUM_TYPES >= 136
-    force_container_instantiations<TestType136>();
+    RUN_TYPE_WORKLOAD(TestType136);
     #endif
     #if NUM_TYPES >= 137
-    force_container_instantiations<TestType137>();
+    RUN_TYPE_WORKLOAD(TestType137);
     #endif
     #if NUM_TYPES >= 138
-    force_container_instantiations<TestType138>();
+    RUN_TYPE_WORKLOAD(TestType138);
     #endif
     #if NUM_TYPES >= 139
-    force_container_instantiations<TestType139>();
+    RUN_TYPE_WORKLOAD(TestType139);
     #endif
     #if NUM_TYPES >= 140
-    force_container_instantiations<TestType140>();
+    RUN_TYPE_WORKLOAD(TestType140);
     #endif
     #if NUM_TYPES >= 141
-    force_container_instantiations<TestType141>();
+    RUN_TYPE_WORKLOAD(TestType141);
     #endif
     #if NUM_TYPES >= 142
-    force_container_instantiations<TestType142>();
+    RUN_TYPE_WORKLOAD(TestType142);
     #endif
     #if NUM_TYPES >= 143
-    force_container_instantiations<TestType143>();
+    RUN_TYPE_WORKLOAD(TestType143);
     #endif
     #if NUM_TYPES >= 144
-    force_container_instantiations<TestType144>();
+    RUN_TYPE_WORKLOAD(TestType144);
     #endif
     #if NUM_TYPES >= 145
-    force_container_instantiations<TestType145>();
+    RUN_TYPE_WORKLOAD(TestType145);
     #endif
     #if NUM_TYPES >= 146
-    force_container_instantiations<TestType146>();
+    RUN_TYPE_WORKLOAD(TestType146);
     #endif
     #if NUM_TYPES >= 147
-    force_container_instantiations<TestType147>();
+    RUN_TYPE_WORKLOAD(TestType147);
     #endif
     #if NUM_TYPES >= 148
-    force_container_instantiations<TestType148>();
+    RUN_TYPE_WORKLOAD(TestType148);
     #endif
     #if NUM_TYPES >= 149
-    force_container_instantiations<TestType149>();
+    RUN_TYPE_WORKLOAD(TestType149);
     #endif
     #if NUM_TYPES >= 150
-    force_container_instantiations<TestType150>();
+    RUN_TYPE_WORKLOAD(TestType150);
     #endif
+#endif
     
+#ifdef RUNTIME_BENCHMARK
+    benchmark_scheduler().run(threads);
+#endif
+    run_global_tracks();
+
+#ifdef RUNTIME_BENCHMARK
+    run_global_kernels();
+    benchmark_report_memory();
+    printf("Runtime benchmark completed successfully.\n");
+#else
     printf("Compilation benchmark test completed successfully.\n");
+#endif
     
 #ifdef USE_STL
     printf("Library: STL\n");
@@ -0,0 +1,35 @@
+// Named module over the EASTL headers used by compilation_benchmark_test.cpp
+// EASTL ships no module interface, so the headers live in the global module fragment
+module;
+
+#include <EASTL/vector.h>
+#include <EASTL/string.h>
+#include <EASTL/list.h>
+#include <EASTL/map.h>
+#include <EASTL/set.h>
+#include <EASTL/hash_map.h>
+#include <EASTL/hash_set.h>
+#include <EASTL/deque.h>
+#include <EASTL/queue.h>
+#include <EASTL/stack.h>
+#include <EASTL/algorithm.h>
+#include <EASTL/sort.h>
+#include <EASTL/utility.h>
+
+export module eastl_containers;
+
+export namespace eastl {
+    using eastl::vector;
+    using eastl::string;
+    using eastl::list;
+    using eastl::map;
+    using eastl::set;
+    using eastl::hash_map;
+    using eastl::hash_set;
+    using eastl::deque;
+    using eastl::queue;
+    using eastl::stack;
+    using eastl::hash;
+    using eastl::index_sequence;
+    using eastl::make_index_sequence;
+}
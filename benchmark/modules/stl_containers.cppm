@@ -0,0 +1,60 @@
+// Named module over the STL headers used by compilation_benchmark_test.cpp
+// With STL_IMPORT_STD the toolchain's `import std;` module is re-exported instead
+// With STL_PMR (STL_ALLOCATOR pmr modes) the std::pmr containers and resources are exported as well
+module;
+
+#if !STL_IMPORT_STD
+#include <vector>
+#include <string>
+#include <list>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <deque>
+#include <queue>
+#include <stack>
+#include <algorithm>
+#include <utility>
+#if STL_PMR
+#include <memory_resource>
+#endif
+#endif
+
+export module stl_containers;
+
+#if STL_IMPORT_STD
+export import std;
+#else
+export namespace std {
+    using std::vector;
+    using std::string;
+    using std::list;
+    using std::map;
+    using std::set;
+    using std::unordered_map;
+    using std::unordered_set;
+    using std::deque;
+    using std::queue;
+    using std::stack;
+    using std::hash;
+    using std::index_sequence;
+    using std::make_index_sequence;
+#if STL_PMR
+    namespace pmr {
+        using std::pmr::vector;
+        using std::pmr::string;
+        using std::pmr::list;
+        using std::pmr::map;
+        using std::pmr::set;
+        using std::pmr::unordered_map;
+        using std::pmr::unordered_set;
+        using std::pmr::deque;
+        using std::pmr::memory_resource;
+        using std::pmr::monotonic_buffer_resource;
+        using std::pmr::unsynchronized_pool_resource;
+        using std::pmr::set_default_resource;
+    }
+#endif
+}
+#endif
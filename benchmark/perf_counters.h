@@ -0,0 +1,71 @@
+// Hardware event counters of the benchmark process through perf_event_open (Linux only)
+// Read by the runtime benchmark next to the allocation counters, so every section can report
+// its cache and branch misses. Without the syscall, the events, or the permission to count them
+// (perf_event_paranoid, containers, VMs without a PMU) the counters read as unavailable.
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include <cstdint>
+#include <cstring>
+
+// Events counted on the calling thread since its first read, user space only; -1 when unavailable
+struct PerfCounts {
+    long long cache_misses;   // last-level cache misses (PERF_COUNT_HW_CACHE_MISSES)
+    long long branch_misses;  // mispredicted branches (PERF_COUNT_HW_BRANCH_MISSES)
+};
+
+#if defined(__linux__)
+inline int perf_counter_open(uint64_t config) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+inline long long perf_counter_read(int fd) {
+    uint64_t value = 0;
+    if(fd < 0 || read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value)) return -1;
+    return (long long)value;
+}
+
+// Counters follow one thread (pid 0), so every thread opens its own on first use; they stay open
+// (and counting) until the thread exits
+struct PerfCounterFds {
+    int cache_misses;
+    int branch_misses;
+    PerfCounterFds()
+        : cache_misses(perf_counter_open(PERF_COUNT_HW_CACHE_MISSES)),
+          branch_misses(perf_counter_open(PERF_COUNT_HW_BRANCH_MISSES)) {}
+    ~PerfCounterFds() {
+        if(cache_misses >= 0) close(cache_misses);
+        if(branch_misses >= 0) close(branch_misses);
+    }
+};
+
+inline PerfCounts perf_counts() {
+    static thread_local PerfCounterFds fds;
+    PerfCounts counts;
+    counts.cache_misses = perf_counter_read(fds.cache_misses);
+    counts.branch_misses = perf_counter_read(fds.branch_misses);
+    return counts;
+}
+#else
+inline PerfCounts perf_counts() {
+    PerfCounts counts;
+    counts.cache_misses = -1;
+    counts.branch_misses = -1;
+    return counts;
+}
+#endif
+
+#endif
@@ -1,20 +1,347 @@
 #ifdef USE_EASTL
-// Simple implementation of EASTL required new/delete operators and functions
+// Implementation of EASTL required new/delete operators and functions
+// Allocations go through a selectable backend (EASTL_ALLOCATOR_BACKEND) and are counted
+// for the runtime benchmark (benchmark/allocation_stats.h)
 #include <new>
 #include <cstdlib>
 #include <cstdio>
 #include <cstdarg>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include "benchmark/allocation_stats.h"
+
+#define EASTL_BACKEND_MALLOC 0   // malloc/free per allocation
+#define EASTL_BACKEND_ARENA 1    // bump arena, rewound once every allocation has been freed
+#define EASTL_BACKEND_POOL 2     // power-of-two size-class free lists carved from slabs
+#define EASTL_BACKEND_TLCACHE 3  // bounded per-thread free lists in front of malloc
+#ifndef EASTL_ALLOCATOR_BACKEND
+#define EASTL_ALLOCATOR_BACKEND EASTL_BACKEND_MALLOC
+#endif
+
+namespace {
+
+// Prefix of every allocation so frees can be routed back to the block the backend handed out.
+// EASTL frees through delete[] without a size, so the requested size is kept here too; together
+// with the alignment slack it gives back the block size, and with it the size class.
+// The header sits right before the returned pointer, which alignmentOffset may leave unaligned,
+// so it is always accessed through memcpy.
+struct AllocationHeader {
+    void* raw;              // start of the backend block
+    size_t requested : 52;  // bytes EASTL asked for
+    size_t slack : 12;      // extra bytes reserved to reach the requested alignment
+};
+static_assert(sizeof(AllocationHeader) == 16, "header must keep the 16-byte alignment of the block");
+
+// Blocks from every backend are 16-byte aligned; larger alignments are reached with slack
+const size_t kBlockAlignment = 16;
+const size_t kMaxAlignment = size_t(1) << 12;
+
+// Counters of the current thread (see allocation_stats.h)
+thread_local AllocationStats t_stats;
+
+// Totals of the threads merged so far. Blocks freed on another thread than the one that
+// allocated them leave live and reserved bytes off on both threads, which cancel out (unsigned
+// wrap-around) once both are added together
+AllocationStats g_merged_stats;
+std::mutex g_merged_mutex;
+
+void add_stats(AllocationStats& total, const AllocationStats& stats) {
+    total.allocations += stats.allocations;
+    total.deallocations += stats.deallocations;
+    total.bytes_requested += stats.bytes_requested;
+    total.live_bytes += stats.live_bytes;
+    total.peak_live_bytes += stats.peak_live_bytes;
+    total.reserved_bytes += stats.reserved_bytes;
+}
+
+// Size classes shared by the pool and thread-cache backends: 16 B .. 64 KB
+const size_t kMinClassShift = 4;
+const size_t kNumClasses = 13;
+
+size_t size_class_for(size_t bytes) {
+    for(size_t cls = 0; cls < kNumClasses; ++cls) {
+        if(bytes <= (size_t(1) << (cls + kMinClassShift))) return cls + 1;
+    }
+    return 0;
+}
+
+size_t class_size(size_t size_class) {
+    return size_t(1) << (size_class - 1 + kMinClassShift);
+}
+
+void* system_allocate(size_t bytes) {
+    void* p = malloc(bytes);
+    if(p) t_stats.reserved_bytes += bytes;
+    return p;
+}
+
+void system_free(void* p, size_t bytes) {
+    t_stats.reserved_bytes -= bytes;
+    free(p);
+}
+
+#if EASTL_ALLOCATOR_BACKEND == EASTL_BACKEND_MALLOC
+const char* const kBackendName = "malloc";
+
+void* backend_allocate(size_t bytes) {
+    return system_allocate(bytes);
+}
+
+void backend_free(void* raw, size_t bytes) {
+    system_free(raw, bytes);
+}
+
+#elif EASTL_ALLOCATOR_BACKEND == EASTL_BACKEND_ARENA
+const char* const kBackendName = "arena";
+
+// Chunks are kept for the whole run; the arena rewinds to the first chunk whenever the
+// live allocation count drops to zero, which happens between container sections.
+// Every thread bumps its own arena, without locks; blocks must be freed on the thread that
+// allocated them, which holds for the benchmark's per-thread containers
+struct ArenaChunk {
+    ArenaChunk* next;
+    size_t capacity;
+};
+static_assert(sizeof(ArenaChunk) % 16 == 0, "chunk header must keep 16-byte alignment");
+
+const size_t kArenaChunkSize = size_t(1) << 20;
+thread_local ArenaChunk* t_arena_first = nullptr;
+thread_local ArenaChunk* t_arena_current = nullptr;
+thread_local size_t t_arena_used = 0;
+thread_local size_t t_arena_live = 0;
+
+void* backend_allocate(size_t bytes) {
+    bytes = (bytes + kBlockAlignment - 1) & ~(kBlockAlignment - 1);
+
+    if(!t_arena_current || t_arena_used + bytes > t_arena_current->capacity) {
+        ArenaChunk* next = t_arena_current ? t_arena_current->next : t_arena_first;
+        if(!next || next->capacity < bytes) {
+            size_t capacity = bytes > kArenaChunkSize ? bytes : kArenaChunkSize;
+            ArenaChunk* chunk = (ArenaChunk*)system_allocate(sizeof(ArenaChunk) + capacity);
+            if(!chunk) return nullptr;
+            chunk->capacity = capacity;
+            chunk->next = next;
+            if(t_arena_current) t_arena_current->next = chunk;
+            else t_arena_first = chunk;
+            next = chunk;
+        }
+        t_arena_current = next;
+        t_arena_used = 0;
+    }
+
+    void* p = (char*)(t_arena_current + 1) + t_arena_used;
+    t_arena_used += bytes;
+    ++t_arena_live;
+    return p;
+}
+
+void backend_free(void* /*raw*/, size_t /*bytes*/) {
+    if(--t_arena_live == 0) {
+        t_arena_current = t_arena_first;
+        t_arena_used = 0;
+    }
+}
+
+#elif EASTL_ALLOCATOR_BACKEND == EASTL_BACKEND_POOL
+const char* const kBackendName = "pool";
+
+// One intrusive free list per size class, refilled from 64 KB slabs; larger requests use malloc.
+// The lists are per thread, like the arena, so blocks go back to the thread that allocated them
+const size_t kPoolSlabSize = size_t(64) << 10;
+thread_local void* t_pool_free[kNumClasses] = {};
+
+void* backend_allocate(size_t bytes) {
+    size_t size_class = size_class_for(bytes);
+    if(!size_class) return system_allocate(bytes);
+
+    void*& head = t_pool_free[size_class - 1];
+    if(!head) {
+        size_t block = class_size(size_class);
+        char* slab = (char*)system_allocate(kPoolSlabSize);
+        if(!slab) return nullptr;
+        for(size_t offset = 0; offset + block <= kPoolSlabSize; offset += block) {
+            *(void**)(slab + offset) = head;
+            head = slab + offset;
+        }
+    }
+    void* p = head;
+    head = *(void**)p;
+    return p;
+}
+
+void backend_free(void* raw, size_t bytes) {
+    size_t size_class = size_class_for(bytes);
+    if(!size_class) {
+        system_free(raw, bytes);
+        return;
+    }
+    void*& head = t_pool_free[size_class - 1];
+    *(void**)raw = head;
+    head = raw;
+}
+
+#elif EASTL_ALLOCATOR_BACKEND == EASTL_BACKEND_TLCACHE
+const char* const kBackendName = "tlcache";
+
+// Up to kThreadCacheLimit freed blocks per size class are kept per thread and reused before
+// going back to malloc; blocks are plain malloc blocks, so any thread may free them
+const unsigned kThreadCacheLimit = 64;
+
+struct ThreadCache {
+    void* head[kNumClasses];
+    unsigned count[kNumClasses];
+
+    ~ThreadCache() {
+        for(size_t cls = 0; cls < kNumClasses; ++cls) {
+            while(head[cls]) {
+                void* p = head[cls];
+                head[cls] = *(void**)p;
+                system_free(p, class_size(cls + 1));
+            }
+        }
+    }
+};
+thread_local ThreadCache t_cache = {};
+
+void* backend_allocate(size_t bytes) {
+    size_t size_class = size_class_for(bytes);
+    if(!size_class) return system_allocate(bytes);
+
+    size_t cls = size_class - 1;
+    if(t_cache.head[cls]) {
+        void* p = t_cache.head[cls];
+        t_cache.head[cls] = *(void**)p;
+        --t_cache.count[cls];
+        return p;
+    }
+    return system_allocate(class_size(size_class));
+}
+
+void backend_free(void* raw, size_t bytes) {
+    size_t size_class = size_class_for(bytes);
+    if(!size_class) {
+        system_free(raw, bytes);
+        return;
+    }
+    size_t cls = size_class - 1;
+    if(t_cache.count[cls] >= kThreadCacheLimit) {
+        system_free(raw, class_size(size_class));
+        return;
+    }
+    *(void**)raw = t_cache.head[cls];
+    t_cache.head[cls] = raw;
+    ++t_cache.count[cls];
+}
+
+#else
+#error "Unknown EASTL_ALLOCATOR_BACKEND"
+#endif
+
+// Returns p with (p + alignmentOffset) % alignment == 0, as EASTL's aligned hook expects
+void* benchmark_allocate(size_t size, size_t alignment = kBlockAlignment, size_t alignmentOffset = 0) {
+    if(alignment < kBlockAlignment) alignment = kBlockAlignment;
+    if(alignment > kMaxAlignment || (alignment & (alignment - 1))) return nullptr;
+
+    // Block start + header is already 16-byte aligned; anything else needs up to alignment - 1 bytes of slack
+    alignmentOffset &= alignment - 1;
+    size_t slack = (alignment == kBlockAlignment && alignmentOffset == 0) ? 0 : alignment - 1;
+    void* raw = backend_allocate(sizeof(AllocationHeader) + size + slack);
+    if(!raw) return nullptr;
+
+    uintptr_t user = (uintptr_t)raw + sizeof(AllocationHeader);
+    user = ((user + alignmentOffset + alignment - 1) & ~(uintptr_t)(alignment - 1)) - alignmentOffset;
+
+    AllocationHeader header;
+    header.raw = raw;
+    header.requested = size;
+    header.slack = slack;
+    memcpy((char*)user - sizeof(AllocationHeader), &header, sizeof(AllocationHeader));
+
+    ++t_stats.allocations;
+    t_stats.bytes_requested += size;
+    t_stats.live_bytes += size;
+    if(t_stats.live_bytes > t_stats.peak_live_bytes) t_stats.peak_live_bytes = t_stats.live_bytes;
+    return (void*)user;
+}
+
+void benchmark_free(void* p) {
+    if(!p) return;
+    AllocationHeader header;
+    memcpy(&header, (char*)p - sizeof(AllocationHeader), sizeof(AllocationHeader));
+
+    ++t_stats.deallocations;
+    t_stats.live_bytes -= header.requested;
+    backend_free(header.raw, sizeof(AllocationHeader) + header.requested + header.slack);
+}
+
+}
+
+AllocationStats allocation_stats() {
+    return t_stats;
+}
+
+AllocationStats allocation_stats_total() {
+    std::lock_guard<std::mutex> lock(g_merged_mutex);
+    AllocationStats total = g_merged_stats;
+    add_stats(total, t_stats);
+    return total;
+}
+
+void allocation_stats_merge_thread() {
+    std::lock_guard<std::mutex> lock(g_merged_mutex);
+    add_stats(g_merged_stats, t_stats);
+    t_stats = AllocationStats();
+}
+
+void reset_peak_live_bytes() {
+    t_stats.peak_live_bytes = t_stats.live_bytes;
+}
+
+const char* allocation_backend_name() {
+    return kBackendName;
+}
 
 // Required by EASTL
-void* operator new[](size_t size, const char* /*name*/, int /*flags*/, 
+void* operator new[](size_t size, const char* /*name*/, int /*flags*/,
                      unsigned /*debugFlags*/, const char* /*file*/, int /*line*/) {
-    return malloc(size);
+    return benchmark_allocate(size);
 }
 
-void* operator new[](size_t size, size_t /*alignment*/, size_t /*alignmentOffset*/,
+void* operator new[](size_t size, size_t alignment, size_t alignmentOffset,
                      const char* /*name*/, int /*flags*/, unsigned /*debugFlags*/,
                      const char* /*file*/, int /*line*/) {
-    return malloc(size);
+    return benchmark_allocate(size, alignment, alignmentOffset);
+}
+
+// EASTL's allocator frees with delete[], so every array new/delete in this binary has to go
+// through the same backend as the hooks above
+void* operator new[](size_t size) {
+    void* p = benchmark_allocate(size);
+    if(!p) {
+#if defined(__cpp_exceptions)
+        throw std::bad_alloc();
+#else
+        abort();  // built with -fno-exceptions (ENABLE_EXCEPTIONS=OFF)
+#endif
+    }
+    return p;
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return benchmark_allocate(size);
+}
+
+void operator delete[](void* p) noexcept {
+    benchmark_free(p);
+}
+
+void operator delete[](void* p, size_t /*size*/) noexcept {
+    benchmark_free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    benchmark_free(p);
 }
 
 // Required by EASTL string formatting
@@ -25,4 +352,4 @@ namespace EA {
         }
     }
 }
-#endif
\ No newline at end of file
+#endif
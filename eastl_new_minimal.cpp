@@ -0,0 +1,40 @@
+#ifdef USE_EASTL
+// Minimal implementation of EASTL required new/delete operators and functions, linked into the
+// compile benchmark targets so they pay for the same small hook TU as before the allocator work.
+// The allocation backends and counters (eastl_new.cpp) only matter when the code runs and are
+// linked into eastl_runtime_benchmark alone.
+#include <new>
+#include <cstdlib>
+#include <cstdio>
+#include <cstdarg>
+#include <cstddef>
+
+// Required by EASTL
+void* operator new[](size_t size, const char* /*name*/, int /*flags*/, 
+                     unsigned /*debugFlags*/, const char* /*file*/, int /*line*/) {
+    return malloc(size);
+}
+
+// The default delete[] frees these blocks with free(), so an over-aligned block has to come from
+// aligned_alloc, whose size must be a multiple of the alignment. EASTL's containers align the block
+// start (alignmentOffset 0); MSVC has no aligned_alloc, and _aligned_malloc blocks cannot go to free()
+void* operator new[](size_t size, size_t alignment, size_t /*alignmentOffset*/,
+                     const char* /*name*/, int /*flags*/, unsigned /*debugFlags*/,
+                     const char* /*file*/, int /*line*/) {
+#if !defined(_MSC_VER)
+    if(alignment > alignof(std::max_align_t)) {
+        return aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+    }
+#endif
+    return malloc(size);
+}
+
+// Required by EASTL string formatting
+namespace EA {
+    namespace StdC {
+        int Vsnprintf(char* pDestination, size_t n, const char* pFormat, va_list arguments) {
+            return vsnprintf(pDestination, n, pFormat, arguments);
+        }
+    }
+}
+#endif
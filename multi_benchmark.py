@@ -6,7 +6,19 @@ This script performs multiple benchmark runs and generates statistical graphs.
 It measures compilation time and binary size across multiple runs to provide
 more reliable statistics with confidence intervals.
 
-Usage: python3 multi_benchmark.py [--runs N] [--build-type Debug|Release] [--output-dir DIR]
+With --phases, each build is also split into frontend, backend and link time
+(from -fsyntax-only and -c passes) and plotted as stacked bars.
+With --cxx20-modules, the C++20 module variant is built as well and its BMI cost
+is reported separately from the consumer TU.
+With --sweep DIMENSION, one build configuration dimension (see SWEEP_DIMENSIONS in
+benchmark.py) is swept and compile time, peak compiler memory and binary size are
+compared per value, optionally crossed with --num-types-mode, along with the code and
+exception handling section sizes (e.g. --sweep exceptions_rtti).
+With --runtime, the runtime variants are built and run as well; sweeps then also report
+ns per element per container section (e.g. --sweep type_family --runtime for copy cost per type shape).
+
+Usage: python3 multi_benchmark.py [--runs N] [--build-type Debug|Release] [--output-dir DIR] [--phases] [--cxx20-modules]
+       [--sweep DIMENSION] [--runtime]
 """
 
 import os
@@ -21,15 +33,21 @@ import matplotlib.patches as mpatches
 from pathlib import Path
 import shutil
 from datetime import datetime
-from benchmark import BenchmarkRunner
+from benchmark import BenchmarkRunner, SWEEP_DIMENSIONS, BINARY_SECTIONS
 
 class MultiBenchmarkRunner:
-    def __init__(self, num_runs=5, build_types=["Debug", "Release"], output_dir="multi_results", num_types_mode=False):
+    def __init__(self, num_runs=5, build_types=["Debug", "Release"], output_dir="multi_results", num_types_mode=False, enable_phases=False, enable_modules=False, sweep_dimension=None, enable_runtime=False, enable_thread_scaling=False):
         self.num_runs = num_runs
         self.build_types = build_types if isinstance(build_types, list) else [build_types]
         self.output_dir = Path(output_dir)
         self.output_dir.mkdir(exist_ok=True)
         self.num_types_mode = num_types_mode
+        self.enable_phases = enable_phases
+        self.enable_modules = enable_modules
+        self.enable_runtime = enable_runtime
+        self.enable_thread_scaling = enable_thread_scaling
+        self.sweep_dimension = sweep_dimension
+        self.sweep_values = list(SWEEP_DIMENSIONS[sweep_dimension].keys()) if sweep_dimension else []
         
         # NUM_TYPES values to test (from 25 to 150 with step 25)
         self.num_types_values = list(range(25, 151, 25)) if num_types_mode else [100]
@@ -44,11 +62,18 @@ class MultiBenchmarkRunner:
             'stl': '#1f77b4',      # Blue
             'eastl': '#ff7f0e',    # Orange
             'debug': '#2ca02c',    # Green
-            'release': '#d62728'   # Red
+            'release': '#d62728',  # Red
+            'frontend': '#9467bd', # Purple
+            'backend': '#8c564b',  # Brown
+            'link': '#7f7f7f'      # Gray
         }
+        self.phases = ['frontend', 'backend', 'link']
     
     def run_multiple_benchmarks(self):
         """Run benchmark multiple times and collect statistics"""
+        if self.sweep_dimension:
+            return self._run_sweep()
+        
         if self.num_types_mode:
             print(f"Starting NUM_TYPES benchmark mode...")
             print(f"Build types: {', '.join(self.build_types)}")
@@ -60,7 +85,9 @@ class MultiBenchmarkRunner:
                 print(f"{'='*60}")
                 
                 # Create a fresh benchmark runner for each NUM_TYPES value
-                runner = BenchmarkRunner(build_types=self.build_types, enable_ftime_trace=False, num_types=num_types)
+                runner = BenchmarkRunner(build_types=self.build_types, enable_ftime_trace=False, num_types=num_types,
+                                         enable_phases=self.enable_phases, enable_modules=self.enable_modules,
+                                         enable_runtime=self.enable_runtime, enable_thread_scaling=self.enable_thread_scaling)
                 
                 if runner.run_benchmarks():
                     # Store results with num_types info
@@ -84,7 +111,9 @@ class MultiBenchmarkRunner:
                 print(f"{'='*60}")
                 
                 # Create a fresh benchmark runner for each run (disable ftime-trace for clean statistics)
-                runner = BenchmarkRunner(build_types=self.build_types, enable_ftime_trace=False)
+                runner = BenchmarkRunner(build_types=self.build_types, enable_ftime_trace=False,
+                                         enable_phases=self.enable_phases, enable_modules=self.enable_modules,
+                                         enable_runtime=self.enable_runtime, enable_thread_scaling=self.enable_thread_scaling)
                 
                 if runner.run_benchmarks():
                     self.all_runs.append(runner.results)
@@ -96,10 +125,77 @@ class MultiBenchmarkRunner:
             print(f"\nAll {self.num_runs} runs completed!")
             return True
     
+    def _run_sweep(self):
+        """Run one benchmark per value of the sweep dimension (and per NUM_TYPES in num_types mode)"""
+        print(f"Starting {self.sweep_dimension} sweep...")
+        print(f"Build types: {', '.join(self.build_types)}")
+        print(f"{self.sweep_dimension} values: {self.sweep_values}")
+        
+        for value in self.sweep_values:
+            for num_types in self.num_types_values:
+                print(f"\n{'='*60}")
+                print(f"{self.sweep_dimension.upper()} = {value}, NUM_TYPES = {num_types}")
+                print(f"{'='*60}")
+                
+                runner = BenchmarkRunner(build_types=self.build_types, enable_ftime_trace=False, num_types=num_types,
+                                         enable_phases=self.enable_phases, enable_modules=self.enable_modules,
+                                         cmake_options=SWEEP_DIMENSIONS[self.sweep_dimension][value],
+                                         enable_runtime=self.enable_runtime, enable_thread_scaling=self.enable_thread_scaling)
+                
+                if runner.run_benchmarks():
+                    result_data = runner.results.copy()
+                    result_data['num_types'] = num_types
+                    result_data['sweep_value'] = value
+                    self.all_runs.append(result_data)
+                    print(f"{self.sweep_dimension}={value}, NUM_TYPES={num_types} completed successfully")
+                else:
+                    print(f"{self.sweep_dimension}={value}, NUM_TYPES={num_types} failed!")
+                    return False
+        
+        print(f"\nAll {self.sweep_dimension} sweep points completed!")
+        return True
+    
+    def _calculate_sweep_statistics(self):
+        """Organize sweep results as statistics[value][num_types][build_type][test][lib]"""
+        self.statistics = {}
+        self.runtime_statistics = {}
+        for run_data in self.all_runs:
+            value = run_data['sweep_value']
+            num_types = run_data['num_types']
+            point = self.statistics.setdefault(value, {}).setdefault(num_types, {})
+            
+            for build_type in self.build_types:
+                if build_type not in run_data:
+                    continue
+                for test_name, test_data in run_data[build_type].items():
+                    for lib in ['stl', 'eastl']:
+                        if lib in test_data and test_data[lib].get('compilation_time') is not None:
+                            point.setdefault(build_type, {}).setdefault(test_name, {})[lib] = {
+                                'compilation_time': test_data[lib]['compilation_time'],
+                                'binary_size': test_data[lib]['binary_size'],
+                                'peak_memory_kb': test_data[lib].get('peak_memory_kb'),
+                                'sections': test_data[lib].get('sections')
+                            }
+            
+            # Runtime results: runtime_statistics[value][num_types][build_type][lib] = {sections, peak_rss_kb, memory}
+            for build_type, runtime in run_data.get('runtime', {}).items():
+                for lib, lib_data in runtime.items():
+                    if 'sections' in lib_data:
+                        self.runtime_statistics.setdefault(value, {}).setdefault(num_types, {}).setdefault(build_type, {})[lib] = {
+                            'sections': lib_data['sections'],
+                            'peak_rss_kb': lib_data.get('peak_rss_kb'),
+                            'memory': lib_data.get('memory'),
+                            'scaling': lib_data.get('scaling')
+                        }
+    
     def calculate_statistics(self):
         """Calculate statistics from all runs"""
         print("Calculating statistics...")
         
+        if self.sweep_dimension:
+            self._calculate_sweep_statistics()
+            return
+        
         if self.num_types_mode:
             # In NUM_TYPES mode, organize data by num_types
             self.statistics = {}
@@ -127,6 +223,15 @@ class MultiBenchmarkRunner:
                                     'compilation_time': comp_time,
                                     'binary_size': bin_size
                                 }
+                                
+                                if test_data[lib].get('bmi_time') is not None:
+                                    self.statistics[num_types][build_type][test_name][lib]['bmi_time'] = test_data[lib]['bmi_time']
+                                
+                                phases = test_data[lib].get('phases')
+                                if phases:
+                                    self.statistics[num_types][build_type][test_name][lib]['phases'] = {
+                                        phase: phases[f'{phase}_time'] for phase in self.phases
+                                    }
         else:
             # Initialize statistics structure for regular mode
             for build_type in self.build_types:
@@ -140,7 +245,9 @@ class MultiBenchmarkRunner:
                         for lib in ['stl', 'eastl']:
                             self.statistics[build_type][test_name][lib] = {
                                 'compilation_time': {'values': [], 'mean': 0, 'median': 0, 'std': 0, 'min': 0, 'max': 0},
-                                'binary_size': {'values': [], 'mean': 0, 'median': 0, 'std': 0, 'min': 0, 'max': 0}
+                                'binary_size': {'values': [], 'mean': 0, 'median': 0, 'std': 0, 'min': 0, 'max': 0},
+                                'bmi_time': {'values': [], 'mean': 0, 'median': 0, 'std': 0, 'min': 0, 'max': 0},
+                                'phases': {phase: [] for phase in self.phases}
                             }
             
             # Collect all values
@@ -157,12 +264,20 @@ class MultiBenchmarkRunner:
                                 
                                 self.statistics[build_type][test_name][lib]['compilation_time']['values'].append(comp_time)
                                 self.statistics[build_type][test_name][lib]['binary_size']['values'].append(bin_size)
+                                
+                                if test_data[lib].get('bmi_time') is not None:
+                                    self.statistics[build_type][test_name][lib]['bmi_time']['values'].append(test_data[lib]['bmi_time'])
+                                
+                                phases = test_data[lib].get('phases')
+                                if phases:
+                                    for phase in self.phases:
+                                        self.statistics[build_type][test_name][lib]['phases'][phase].append(phases[f'{phase}_time'])
             
             # Calculate statistics
             for build_type in self.statistics:
                 for test_name in self.statistics[build_type]:
                     for lib in ['stl', 'eastl']:
-                        for metric in ['compilation_time', 'binary_size']:
+                        for metric in ['compilation_time', 'binary_size', 'bmi_time']:
                             values = self.statistics[build_type][test_name][lib][metric]['values']
                             if values:
                                 self.statistics[build_type][test_name][lib][metric].update({
@@ -172,6 +287,15 @@ class MultiBenchmarkRunner:
                                     'min': min(values),
                                     'max': max(values)
                                 })
+                        
+                        # Phase breakdown is plotted from per-phase means
+                        phase_values = self.statistics[build_type][test_name][lib]['phases']
+                        if all(phase_values.values()):
+                            self.statistics[build_type][test_name][lib]['phases'] = {
+                                phase: statistics.mean(values) for phase, values in phase_values.items()
+                            }
+                        else:
+                            del self.statistics[build_type][test_name][lib]['phases']
     
     def generate_graphs(self):
         """Generate compilation time line graphs"""
@@ -179,12 +303,22 @@ class MultiBenchmarkRunner:
         
         timestamp = datetime.now().strftime("%Y%m%d_%H%M%S")
         
+        if self.sweep_dimension:
+            self._plot_sweep_comparison(timestamp)
+            print(f"Graphs saved to {self.output_dir}/")
+            return
+        
         if self.num_types_mode:
             self._plot_num_types_comparison(timestamp)
+            if self.enable_modules:
+                self._plot_modules_comparison(timestamp)
         else:
             # Only compilation time line graphs
             self._plot_compilation_time_comparison(timestamp)
         
+        if self.enable_phases:
+            self._plot_phase_breakdown(timestamp)
+        
         print(f"Graphs saved to {self.output_dir}/")
     
     def _plot_compilation_time_comparison(self, timestamp):
@@ -206,10 +340,12 @@ class MultiBenchmarkRunner:
                 # X axis: run numbers (1, 2, 3, ...)
                 run_numbers = list(range(1, len(stl_values) + 1))
                 
-                # Plot lines for STL and EASTL
-                ax.plot(run_numbers, stl_values, 'o-', label='STL', 
+                # Plot lines for STL and EASTL (extra variants such as modules are dashed)
+                suffix = '' if test_name == 'compilation_benchmark_test' else f" ({test_name.replace('_benchmark_test', '')})"
+                style = '-' if not suffix else '--'
+                ax.plot(run_numbers, stl_values, 'o' + style, label='STL' + suffix, 
                        color=self.colors['stl'], linewidth=2, markersize=6)
-                ax.plot(run_numbers, eastl_values, 's-', label='EASTL', 
+                ax.plot(run_numbers, eastl_values, 's' + style, label='EASTL' + suffix, 
                        color=self.colors['eastl'], linewidth=2, markersize=6)
                 
 
@@ -283,6 +419,143 @@ class MultiBenchmarkRunner:
         plt.savefig(self.output_dir / f'num_types_comparison_{timestamp}.png', dpi=300, bbox_inches='tight')
         plt.close()
 
+    def _sweep_metric(self, value, num_types, build_type, lib, metric):
+        """Look up one metric of the main benchmark test at a sweep point (0 when missing)"""
+        point = self.statistics.get(value, {}).get(num_types, {}).get(build_type, {})
+        return point.get('compilation_benchmark_test', {}).get(lib, {}).get(metric) or 0
+    
+    def _plot_sweep_comparison(self, timestamp):
+        """Plot compile time, peak compiler memory and binary size per sweep value"""
+        metrics = [('compilation_time', 'Compilation Time (seconds)', 1),
+                   ('peak_memory_kb', 'Peak Compiler Memory (MB)', 1024),
+                   ('binary_size', 'Binary Size (KB)', 1024)]
+        fig, axes = plt.subplots(len(metrics), len(self.build_types),
+                                 figsize=(10*len(self.build_types), 5*len(metrics)), squeeze=False)
+        markers = ['o', 's', '^', 'D', 'v', 'P', 'X', '*']
+        
+        for col, build_type in enumerate(self.build_types):
+            for row, (metric, ylabel, scale) in enumerate(metrics):
+                ax = axes[row][col]
+                
+                if len(self.num_types_values) > 1:
+                    # One line per (library, value) across NUM_TYPES
+                    num_types_sorted = sorted(self.num_types_values)
+                    for i, value in enumerate(self.sweep_values):
+                        for lib, style in [('stl', '-'), ('eastl', '--')]:
+                            values = [self._sweep_metric(value, n, build_type, lib, metric) / scale for n in num_types_sorted]
+                            ax.plot(num_types_sorted, values, markers[i % len(markers)] + style,
+                                    label=f'{lib.upper()} {value}', linewidth=2, markersize=6)
+                    ax.set_xlabel('Number of Types')
+                    ax.set_xticks(num_types_sorted)
+                else:
+                    # Grouped bars: one group per value, STL and EASTL side by side
+                    num_types = self.num_types_values[0]
+                    x = np.arange(len(self.sweep_values))
+                    width = 0.38
+                    for offset, lib in [(-width / 2, 'stl'), (width / 2, 'eastl')]:
+                        values = [self._sweep_metric(value, num_types, build_type, lib, metric) / scale for value in self.sweep_values]
+                        ax.bar(x + offset, values, width, label=lib.upper(), color=self.colors[lib])
+                    ax.set_xticks(x)
+                    ax.set_xticklabels(self.sweep_values)
+                    ax.set_xlabel(f'{self.sweep_dimension} (NUM_TYPES={num_types})')
+                
+                ax.set_ylabel(ylabel)
+                ax.set_title(f'{ylabel.split(" (")[0]} by {self.sweep_dimension} - {build_type}')
+                ax.legend()
+                ax.grid(True, alpha=0.3)
+        
+        plt.tight_layout()
+        plt.savefig(self.output_dir / f'{self.sweep_dimension}_sweep_{timestamp}.png', dpi=300, bbox_inches='tight')
+        plt.close()
+
+    def _plot_modules_comparison(self, timestamp):
+        """Plot header build vs module consumer TU vs BMI build across NUM_TYPES"""
+        fig, axes = plt.subplots(1, len(self.build_types), figsize=(10*len(self.build_types), 6))
+        if len(self.build_types) == 1:
+            axes = [axes]
+        
+        num_types_sorted = sorted(self.num_types_values)
+        
+        for i, build_type in enumerate(self.build_types):
+            ax = axes[i]
+            
+            for lib, label in [('stl', 'STL'), ('eastl', 'EASTL')]:
+                header_times, consumer_times, bmi_times = [], [], []
+                for num_types in num_types_sorted:
+                    build_stats = self.statistics.get(num_types, {}).get(build_type, {})
+                    header_data = build_stats.get('compilation_benchmark_test', {}).get(lib, {})
+                    module_data = build_stats.get('modules_benchmark_test', {}).get(lib, {})
+                    header_times.append(header_data.get('compilation_time', 0))
+                    consumer_times.append(module_data.get('compilation_time', 0))
+                    bmi_times.append(module_data.get('bmi_time', 0))
+                
+                ax.plot(num_types_sorted, header_times, 'o-', label=f'{label} headers',
+                       color=self.colors[lib], linewidth=2, markersize=6)
+                ax.plot(num_types_sorted, consumer_times, 's--', label=f'{label} module consumer TU',
+                       color=self.colors[lib], linewidth=2, markersize=6)
+                ax.plot(num_types_sorted, bmi_times, '^:', label=f'{label} BMI build',
+                       color=self.colors[lib], linewidth=2, markersize=6)
+            
+            ax.set_xlabel('Number of Types')
+            ax.set_ylabel('Compilation Time (seconds)')
+            ax.set_title(f'Headers vs C++20 Modules - {build_type}')
+            ax.legend()
+            ax.grid(True, alpha=0.3)
+            ax.set_xticks(num_types_sorted)
+        
+        plt.tight_layout()
+        plt.savefig(self.output_dir / f'modules_comparison_{timestamp}.png', dpi=300, bbox_inches='tight')
+        plt.close()
+
+    def _plot_phase_breakdown(self, timestamp):
+        """Plot frontend/backend/link time as stacked bars, STL and EASTL side by side"""
+        fig, axes = plt.subplots(1, len(self.build_types), figsize=(10*len(self.build_types), 6))
+        if len(self.build_types) == 1:
+            axes = [axes]
+        
+        for i, build_type in enumerate(self.build_types):
+            ax = axes[i]
+            
+            # One group per NUM_TYPES value, or a single group of run means
+            if self.num_types_mode:
+                group_labels = sorted(self.num_types_values)
+                group_stats = [self.statistics.get(n, {}).get(build_type, {}) for n in group_labels]
+            else:
+                group_labels = [f'{self.num_runs}-run mean']
+                group_stats = [self.statistics.get(build_type, {})]
+            
+            x = np.arange(len(group_labels))
+            width = 0.38
+            
+            for offset, lib, hatch in [(-width / 2, 'stl', ''), (width / 2, 'eastl', '//')]:
+                bottoms = np.zeros(len(group_labels))
+                for phase in self.phases:
+                    heights = []
+                    for stats in group_stats:
+                        test_data = next(iter(stats.values()), {}) if stats else {}
+                        heights.append(test_data.get(lib, {}).get('phases', {}).get(phase, 0))
+                    
+                    ax.bar(x + offset, heights, width, bottom=bottoms, color=self.colors[phase],
+                           hatch=hatch, edgecolor='black', linewidth=0.5)
+                    bottoms += np.array(heights)
+            
+            # Legend: phase colors plus library hatching
+            handles = [mpatches.Patch(facecolor=self.colors[phase], label=phase.capitalize()) for phase in self.phases]
+            handles += [mpatches.Patch(facecolor='white', edgecolor='black', label='STL'),
+                        mpatches.Patch(facecolor='white', edgecolor='black', hatch='//', label='EASTL')]
+            
+            ax.set_xticks(x)
+            ax.set_xticklabels([str(label) for label in group_labels])
+            ax.set_xlabel('Number of Types' if self.num_types_mode else '')
+            ax.set_ylabel('Compilation Time (seconds)')
+            ax.set_title(f'Compilation Phase Breakdown - {build_type}')
+            ax.legend(handles=handles)
+            ax.grid(True, axis='y', alpha=0.3)
+        
+        plt.tight_layout()
+        plt.savefig(self.output_dir / f'phase_breakdown_{timestamp}.png', dpi=300, bbox_inches='tight')
+        plt.close()
+
     def save_statistics(self):
         """Save detailed statistics to JSON file"""
         timestamp = datetime.now().strftime("%Y%m%d_%H%M%S")
@@ -315,7 +588,9 @@ class MultiBenchmarkRunner:
             f.write(f"Multi-Run STL vs EASTL Benchmark Results\n")
             f.write(f"{'='*50}\n\n")
             
-            if self.num_types_mode:
+            if self.sweep_dimension:
+                self._write_sweep_summary(f, timestamp)
+            elif self.num_types_mode:
                 f.write(f"Mode: NUM_TYPES comparison\n")
                 f.write(f"NUM_TYPES values: {self.num_types_values}\n")
                 f.write(f"Build types: {', '.join(self.build_types)}\n")
@@ -344,6 +619,12 @@ class MultiBenchmarkRunner:
                             f.write(f"{num_types:<10} {stl_time:<12.2f} {eastl_time:<12.2f} {ratio:<15.2f} {stl_size:<15.2f} {eastl_size:<15.2f}\n")
                     
                     f.write("\n")
+                    
+                    if self.enable_phases:
+                        self._write_phase_table(f, build_type)
+                    
+                    if self.enable_modules:
+                        self._write_modules_table(f, build_type)
             else:
                 f.write(f"Number of runs: {self.num_runs}\n")
                 f.write(f"Build types: {', '.join(self.build_types)}\n")
@@ -369,6 +650,15 @@ class MultiBenchmarkRunner:
                             ratio = stl_comp['mean'] / eastl_comp['mean']
                             f.write(f"  Ratio: {ratio:.2f}x ({'STL faster' if ratio < 1 else 'EASTL faster'})\n\n")
                         
+                        # BMI build statistics (module variant only)
+                        stl_bmi = self.statistics[build_type][test_name]['stl']['bmi_time']
+                        eastl_bmi = self.statistics[build_type][test_name]['eastl']['bmi_time']
+                        
+                        if stl_bmi['values'] and eastl_bmi['values']:
+                            f.write(f"BMI Build Time (seconds):\n")
+                            f.write(f"  STL:   Mean={stl_bmi['mean']:.3f}, Std={stl_bmi['std']:.3f}\n")
+                            f.write(f"  EASTL: Mean={eastl_bmi['mean']:.3f}, Std={eastl_bmi['std']:.3f}\n\n")
+                        
                         # Binary size statistics
                         stl_size = self.statistics[build_type][test_name]['stl']['binary_size']
                         eastl_size = self.statistics[build_type][test_name]['eastl']['binary_size']
@@ -381,9 +671,164 @@ class MultiBenchmarkRunner:
                             ratio = stl_size['mean'] / eastl_size['mean']
                             f.write(f"  Ratio: {ratio:.2f}x ({'STL smaller' if ratio < 1 else 'EASTL smaller'})\n\n")
                         
+                        # Phase split means
+                        stl_phases = self.statistics[build_type][test_name]['stl'].get('phases')
+                        eastl_phases = self.statistics[build_type][test_name]['eastl'].get('phases')
+                        
+                        if stl_phases and eastl_phases:
+                            f.write(f"Compilation Phases (mean seconds):\n")
+                            for phase in self.phases:
+                                f.write(f"  {phase.capitalize():<9} STL: {stl_phases[phase]:.3f}, EASTL: {eastl_phases[phase]:.3f}\n")
+                            f.write("\n")
+                        
                         f.write("\n")
         
         print(f"Summary saved to: {filename}")
+    
+    def _write_sweep_summary(self, f, timestamp):
+        """Write per-value compile time, memory and size, with the first value as baseline"""
+        baseline = self.sweep_values[0]
+        f.write(f"Mode: {self.sweep_dimension} sweep\n")
+        f.write(f"Values: {self.sweep_values} (baseline: {baseline})\n")
+        f.write(f"NUM_TYPES values: {self.num_types_values}\n")
+        f.write(f"Build types: {', '.join(self.build_types)}\n")
+        f.write(f"Timestamp: {timestamp}\n\n")
+        
+        for build_type in self.build_types:
+            f.write(f"BUILD TYPE: {build_type.upper()}\n")
+            f.write(f"{'='*(len(build_type) + 12)}\n\n")
+            
+            f.write(f"{'Value':<16} {'NUM_TYPES':<10} {'Library':<8} {'Time (s)':<10} {'vs base':<9} {'Memory (MB)':<12} {'vs base':<9} {'Size (KB)':<12} {'vs base':<9}\n")
+            f.write(f"{'-'*16} {'-'*10} {'-'*8} {'-'*10} {'-'*9} {'-'*12} {'-'*9} {'-'*12} {'-'*9}\n")
+            
+            for value in self.sweep_values:
+                for num_types in sorted(self.num_types_values):
+                    for lib in ['stl', 'eastl']:
+                        row = []
+                        for metric, scale, width in [('compilation_time', 1, 10), ('peak_memory_kb', 1024, 12), ('binary_size', 1024, 12)]:
+                            current = self._sweep_metric(value, num_types, build_type, lib, metric)
+                            base = self._sweep_metric(baseline, num_types, build_type, lib, metric)
+                            ratio = f"{current / base:.2f}x" if base else "-"
+                            row.append(f"{current / scale:<{width}.2f} {ratio:<9}")
+                        f.write(f"{value:<16} {num_types:<10} {lib.upper():<8} {' '.join(row)}\n")
+            
+            f.write("\n")
+            
+            self._write_section_sweep_table(f, build_type)
+            
+            if self.enable_runtime:
+                self._write_runtime_sweep_table(f, build_type)
+    
+    def _write_section_sweep_table(self, f, build_type):
+        """Write code and exception handling section sizes per value (e.g. --sweep exceptions_rtti)"""
+        if not any(self._sweep_metric(value, num_types, build_type, lib, 'sections')
+                   for value in self.sweep_values for num_types in self.num_types_values for lib in ['stl', 'eastl']):
+            return
+        f.write(f"{'Value':<16} {'NUM_TYPES':<10} {'Library':<8} " + " ".join(f"{section + ' (KB)':<24}" for section in BINARY_SECTIONS) + "\n")
+        f.write(f"{'-'*16} {'-'*10} {'-'*8} " + " ".join('-'*24 for _ in BINARY_SECTIONS) + "\n")
+        
+        for value in self.sweep_values:
+            for num_types in sorted(self.num_types_values):
+                for lib in ['stl', 'eastl']:
+                    sections = self._sweep_metric(value, num_types, build_type, lib, 'sections')
+                    if not sections:
+                        continue
+                    f.write(f"{value:<16} {num_types:<10} {lib.upper():<8} " +
+                            " ".join(f"{sections.get(section, 0) / 1024:<24.2f}" for section in BINARY_SECTIONS) + "\n")
+        
+        f.write("\n")
+    
+    def _write_runtime_sweep_table(self, f, build_type):
+        """Write runtime ns, allocations and overhead per element per section and value, with the first value as baseline"""
+        baseline = self.sweep_values[0]
+        f.write(f"{'Value':<16} {'NUM_TYPES':<10} {'Library':<8} {'Section':<28} {'ns/elem':<10} {'vs base':<9} {'allocs/elem':<12} {'overhead B':<11}\n")
+        f.write(f"{'-'*16} {'-'*10} {'-'*8} {'-'*28} {'-'*10} {'-'*9} {'-'*12} {'-'*11}\n")
+        
+        for value in self.sweep_values:
+            for num_types in sorted(self.num_types_values):
+                for lib in ['stl', 'eastl']:
+                    sections = self.runtime_statistics.get(value, {}).get(num_types, {}).get(build_type, {}).get(lib, {}).get('sections', {})
+                    base_sections = self.runtime_statistics.get(baseline, {}).get(num_types, {}).get(build_type, {}).get(lib, {}).get('sections', {})
+                    for section in sorted(sections):
+                        current = sections[section].get('ns_per_element')
+                        base = base_sections.get(section, {}).get('ns_per_element')
+                        if current is None:
+                            continue
+                        ratio = f"{current / base:.2f}x" if base else "-"
+                        allocations = sections[section].get('allocations_per_element')
+                        allocations = f"{allocations:.3f}" if allocations is not None else "-"
+                        overhead = sections[section].get('overhead_per_element')
+                        overhead = f"{overhead:.1f}" if overhead is not None else "-"
+                        f.write(f"{value:<16} {num_types:<10} {lib.upper():<8} {section:<28} {current:<10.3f} {ratio:<9} {allocations:<12} {overhead:<11}\n")
+        
+        f.write("\n")
+        
+        # Process footprint per value: peak RSS, plus the allocator totals where the build counts them
+        f.write(f"{'Value':<16} {'NUM_TYPES':<10} {'Library':<8} {'Peak RSS (MB)':<14} {'Allocations':<12} {'Reserved (MB)':<14}\n")
+        f.write(f"{'-'*16} {'-'*10} {'-'*8} {'-'*14} {'-'*12} {'-'*14}\n")
+        
+        for value in self.sweep_values:
+            for num_types in sorted(self.num_types_values):
+                for lib in ['stl', 'eastl']:
+                    data = self.runtime_statistics.get(value, {}).get(num_types, {}).get(build_type, {}).get(lib)
+                    if not data:
+                        continue
+                    rss = f"{data['peak_rss_kb'] / 1024:.1f}" if data['peak_rss_kb'] is not None else "-"
+                    memory = data['memory'] or {}
+                    allocations = memory.get('allocations', "-")
+                    reserved = f"{memory['reserved_bytes'] / 1048576:.1f}" if 'reserved_bytes' in memory else "-"
+                    f.write(f"{value:<16} {num_types:<10} {lib.upper():<8} {rss:<14} {allocations:<12} {reserved:<14}\n")
+        
+        f.write("\n")
+        
+        # Thread scaling per value (--thread-scaling): e.g. the malloc vs arena EASTL hooks under contention
+        if self.enable_thread_scaling:
+            f.write(f"{'Value':<16} {'NUM_TYPES':<10} {'Library':<8} {'Threads':<8} {'Tasks/s':<10} {'Speedup':<8} {'Efficiency':<11} {'Slowdown':<9}\n")
+            f.write(f"{'-'*16} {'-'*10} {'-'*8} {'-'*8} {'-'*10} {'-'*8} {'-'*11} {'-'*9}\n")
+            
+            for value in self.sweep_values:
+                for num_types in sorted(self.num_types_values):
+                    for lib in ['stl', 'eastl']:
+                        data = self.runtime_statistics.get(value, {}).get(num_types, {}).get(build_type, {}).get(lib)
+                        for point in (data or {}).get('scaling') or []:
+                            f.write(f"{value:<16} {num_types:<10} {lib.upper():<8} {point['threads']:<8} {point['tasks_per_second']:<10.2f} "
+                                    f"{point['speedup']:<8.2f} {point['efficiency']:<11.2f} {point['task_slowdown']:<9.2f}\n")
+            
+            f.write("\n")
+    
+    def _write_modules_table(self, f, build_type):
+        """Write the per-NUM_TYPES header build vs module consumer vs BMI table"""
+        f.write(f"{'NUM_TYPES':<10} {'Library':<8} {'Headers':<10} {'Consumer':<10} {'BMI':<10}\n")
+        f.write(f"{'-'*10} {'-'*8} {'-'*10} {'-'*10} {'-'*10}\n")
+        
+        for num_types in sorted(self.num_types_values):
+            build_stats = self.statistics.get(num_types, {}).get(build_type, {})
+            for lib in ['stl', 'eastl']:
+                header_data = build_stats.get('compilation_benchmark_test', {}).get(lib, {})
+                module_data = build_stats.get('modules_benchmark_test', {}).get(lib, {})
+                if 'bmi_time' in module_data:
+                    f.write(f"{num_types:<10} {lib.upper():<8} {header_data.get('compilation_time', 0):<10.2f} "
+                            f"{module_data['compilation_time']:<10.2f} {module_data['bmi_time']:<10.2f}\n")
+        
+        f.write("\n")
+    
+    def _write_phase_table(self, f, build_type):
+        """Write the per-NUM_TYPES frontend/backend/link table"""
+        f.write(f"{'NUM_TYPES':<10} {'Library':<8} {'Frontend':<10} {'Backend':<10} {'Link':<10}\n")
+        f.write(f"{'-'*10} {'-'*8} {'-'*10} {'-'*10} {'-'*10}\n")
+        
+        for num_types in sorted(self.num_types_values):
+            if num_types not in self.statistics or build_type not in self.statistics[num_types]:
+                continue
+            test_name = list(self.statistics[num_types][build_type].keys())[0]
+            test_data = self.statistics[num_types][build_type][test_name]
+            
+            for lib in ['stl', 'eastl']:
+                phases = test_data.get(lib, {}).get('phases')
+                if phases:
+                    f.write(f"{num_types:<10} {lib.upper():<8} {phases['frontend']:<10.2f} {phases['backend']:<10.2f} {phases['link']:<10.2f}\n")
+        
+        f.write("\n")
 
 def main():
     parser = argparse.ArgumentParser(description="Multi-run STL vs EASTL Benchmark with Graph Generation")
@@ -394,6 +839,13 @@ def main():
     parser.add_argument("--release-only", action="store_true", help="Run only Release build")
     parser.add_argument("--output-dir", default="multi_results", help="Output directory for results and graphs")
     parser.add_argument("--num-types-mode", action="store_true", help="Run NUM_TYPES comparison mode (25 to 150 with step 25)")
+    parser.add_argument("--phases", action="store_true", help="Split compilation into frontend/backend/link and plot stacked bars")
+    parser.add_argument("--cxx20-modules", action="store_true", help="Also benchmark the C++20 module variant (BMI cost reported separately)")
+    parser.add_argument("--sweep", choices=list(SWEEP_DIMENSIONS.keys()), default=None,
+                        help="Sweep one build configuration dimension (combine with --num-types-mode to cross with NUM_TYPES)")
+    parser.add_argument("--runtime", action="store_true", help="Also build and run the runtime variants (ns per element per container section)")
+    parser.add_argument("--thread-scaling", action="store_true",
+                        help="With --runtime, also report thread scaling of the type workloads (e.g. --sweep eastl_allocator)")
     
     args = parser.parse_args()
     
@@ -417,7 +869,10 @@ def main():
         print("Please install required packages: pip install matplotlib numpy")
         return 1
     
-    runner = MultiBenchmarkRunner(num_runs=args.runs, build_types=build_types, output_dir=args.output_dir, num_types_mode=args.num_types_mode)
+    runner = MultiBenchmarkRunner(num_runs=args.runs, build_types=build_types, output_dir=args.output_dir, num_types_mode=args.num_types_mode,
+                                 enable_phases=args.phases, enable_modules=args.cxx20_modules,
+                                 sweep_dimension=args.sweep, enable_runtime=args.runtime,
+                                 enable_thread_scaling=args.thread_scaling)
     
     if runner.run_multiple_benchmarks():
         runner.calculate_statistics()
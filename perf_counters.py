@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Hardware and software event counters for the compiler and linker processes (Linux perf_event_open)
+
+The counters are opened on this process with inherit set, so every process started while they are
+enabled (cmake --build, the build tool, the compiler driver, cc1plus, the linker) counts into them,
+and a child's counts are folded back into ours when it exits. Counting is user space only for the
+hardware events, which is what perf_event_paranoid <= 2 allows without privileges.
+
+Events that cannot be opened (no syscall, no PMU in a VM or container, seccomp, paranoid level)
+are reported as None; when none of them open, PerfCounters.available is False and callers skip them.
+"""
+
+import ctypes
+import fcntl
+import os
+import platform
+import sys
+
+# perf_event_open syscall numbers per architecture (unistd.h)
+SYSCALL_NUMBERS = {
+    "x86_64": 298,
+    "i386": 336,
+    "i686": 336,
+    "aarch64": 241,
+    "arm64": 241,
+    "armv7l": 364,
+    "ppc64le": 319,
+    "riscv64": 241,
+}
+
+PERF_TYPE_HARDWARE = 0
+PERF_TYPE_SOFTWARE = 1
+
+# ioctls on a counter fd (linux/perf_event.h)
+PERF_EVENT_IOC_ENABLE = 0x2400
+PERF_EVENT_IOC_DISABLE = 0x2401
+PERF_EVENT_IOC_RESET = 0x2403
+
+# perf_event_attr flag bits
+ATTR_DISABLED = 1 << 0
+ATTR_INHERIT = 1 << 1
+ATTR_EXCLUDE_KERNEL = 1 << 5
+ATTR_EXCLUDE_HV = 1 << 6
+
+# Counted events: (result key, perf type, perf config)
+EVENTS = [
+    ("cycles", PERF_TYPE_HARDWARE, 0),            # PERF_COUNT_HW_CPU_CYCLES
+    ("instructions", PERF_TYPE_HARDWARE, 1),      # PERF_COUNT_HW_INSTRUCTIONS
+    ("cache_misses", PERF_TYPE_HARDWARE, 3),      # PERF_COUNT_HW_CACHE_MISSES
+    ("page_faults", PERF_TYPE_SOFTWARE, 2),       # PERF_COUNT_SW_PAGE_FAULTS
+    ("context_switches", PERF_TYPE_SOFTWARE, 3),  # PERF_COUNT_SW_CONTEXT_SWITCHES
+]
+
+class PerfEventAttr(ctypes.Structure):
+    """perf_event_attr up to config1 (PERF_ATTR_SIZE_VER0, accepted by every kernel with the syscall)"""
+    _fields_ = [
+        ("type", ctypes.c_uint32),
+        ("size", ctypes.c_uint32),
+        ("config", ctypes.c_uint64),
+        ("sample_period", ctypes.c_uint64),
+        ("sample_type", ctypes.c_uint64),
+        ("read_format", ctypes.c_uint64),
+        ("flags", ctypes.c_uint64),
+        ("wakeup_events", ctypes.c_uint32),
+        ("bp_type", ctypes.c_uint32),
+        ("config1", ctypes.c_uint64),
+    ]
+
+def open_counter(syscall, number, event_type, config):
+    """Open one disabled, inherited counter on this process; returns the fd or None"""
+    attr = PerfEventAttr()
+    attr.type = event_type
+    attr.size = ctypes.sizeof(PerfEventAttr)
+    attr.config = config
+    attr.flags = ATTR_DISABLED | ATTR_INHERIT | ATTR_EXCLUDE_HV
+    # Software events (page faults, context switches) happen in the kernel on the process's behalf
+    if event_type == PERF_TYPE_HARDWARE:
+        attr.flags |= ATTR_EXCLUDE_KERNEL
+    fd = syscall(number, ctypes.byref(attr), 0, -1, -1, 0)
+    return fd if fd >= 0 else None
+
+class PerfCounters:
+    """Counts EVENTS over this process and its children between start() and stop()"""
+
+    def __init__(self):
+        self.fds = {}
+        number = SYSCALL_NUMBERS.get(platform.machine())
+        if not sys.platform.startswith("linux") or number is None:
+            return
+        try:
+            libc = ctypes.CDLL(None, use_errno=True)
+            syscall = libc.syscall
+            syscall.restype = ctypes.c_long
+        except (OSError, AttributeError):
+            return
+        for name, event_type, config in EVENTS:
+            fd = open_counter(syscall, number, event_type, config)
+            if fd is not None:
+                self.fds[name] = fd
+
+    @property
+    def available(self):
+        return bool(self.fds)
+
+    def start(self):
+        """Zero and enable every open counter (inherited children start counting from here)"""
+        for fd in self.fds.values():
+            fcntl.ioctl(fd, PERF_EVENT_IOC_RESET, 0)
+            fcntl.ioctl(fd, PERF_EVENT_IOC_ENABLE, 0)
+
+    def stop(self):
+        """Disable the counters and return {event: count or None}; call after the children exited"""
+        counts = {}
+        for name, _, _ in EVENTS:
+            fd = self.fds.get(name)
+            if fd is None:
+                counts[name] = None
+                continue
+            fcntl.ioctl(fd, PERF_EVENT_IOC_DISABLE, 0)
+            data = os.read(fd, 8)
+            counts[name] = int.from_bytes(data, sys.byteorder) if len(data) == 8 else None
+        return counts
+
+    def close(self):
+        for fd in self.fds.values():
+            os.close(fd)
+        self.fds = {}
+
+def add_counts(a, b, sign=1):
+    """Event-wise a + sign * b, None where either side is missing"""
+    return {name: (a[name] + sign * b[name]) if a.get(name) is not None and b.get(name) is not None else None
+            for name, _, _ in EVENTS}
+
+if __name__ == "__main__":
+    # Smoke test: count a short-lived child process
+    import subprocess
+    counters = PerfCounters()
+    if not counters.available:
+        print("perf_event_open counters unavailable on this system")
+        sys.exit(0)
+    counters.start()
+    subprocess.run(["sh", "-c", "i=0; while [ $i -lt 20000 ]; do i=$((i+1)); done"])
+    for name, count in counters.stop().items():
+        print(f"{name}: {count if count is not None else 'unavailable'}")
+    counters.close()
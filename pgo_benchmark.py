@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""
+Profile-guided optimization of the STL and EASTL runtime benchmarks
+
+The runtime variants (fixed element counts and seed) are built three times in one build directory
+through the PGO_MODE CMake option:
+1. off: plain build, the baseline build time, binary size and runtime
+2. generate: instrumented build (-fprofile-generate, -fprofile-instr-generate on Clang), run once on
+   its own workload to write the training profile
+3. use: optimized build from that profile (-fprofile-use / -fprofile-instr-use)
+
+GCC finds its .gcda files by object path, which is why every step shares the build directory.
+Clang's .profraw files are merged per target with llvm-profdata before the use build.
+Reported per library: instrumented and optimized build time, binary sizes, runtime speedup over the
+baseline. It also reports whether PGO narrows or widens the STL vs EASTL runtime gap.
+
+Usage: python3 pgo_benchmark.py [--build-type Release|RelWithDebInfo|MinSizeRel|Debug] [--num-types N] [--runs N]
+       [--tracks TRACKS] [--llvm-profdata PATH] [--clean]
+"""
+
+import argparse
+import glob
+import json
+import math
+import shutil
+import statistics
+import subprocess
+import time
+from pathlib import Path
+
+from benchmark import BenchmarkRunner, SWEEP_DIMENSIONS
+
+class PGOBenchmark:
+    def __init__(self, build_dir="build_pgo", results_dir="results", build_type="Release", num_types=100, runs=3,
+                 cmake_options=None, llvm_profdata=None):
+        self.build_type = build_type
+        self.runs = runs
+        self.profile_dir = Path(build_dir).resolve() / "pgo-profiles"
+        self.llvm_profdata = llvm_profdata
+        self.libraries = ["stl", "eastl"]
+        options = dict(cmake_options or {})
+        options["PGO_PROFILE_DIR"] = str(self.profile_dir)
+        self.runner = BenchmarkRunner(build_dir=build_dir, results_dir=results_dir, build_types=[build_type],
+                                      enable_ftime_trace=False, num_types=num_types, cmake_options=options,
+                                      enable_runtime=True)
+        self.results = {"build_type": build_type, "num_types": num_types, "runs": runs}
+
+    def configure(self, mode):
+        self.runner.cmake_options["PGO_MODE"] = mode
+        return self.runner.run_cmake(self.build_type)
+
+    def build(self, lib):
+        """Build the runtime target from scratch; returns (build time, binary size) or None"""
+        compilation_time, binary_size, _, _ = self.runner.compile_target(f"{lib}_runtime_benchmark")
+        if compilation_time is None:
+            return None
+        return round(compilation_time, 3), binary_size
+
+    def measure_runtime(self, lib):
+        """Median total and per-track runtime over self.runs runs"""
+        totals = []
+        tracks = {}
+        for _ in range(self.runs):
+            runtime = self.runner.run_runtime_benchmark(lib)
+            if not runtime:
+                return None
+            totals.append(runtime["total_ns"])
+            run_tracks = {}
+            for record in runtime["records"]:
+                run_tracks[record["track"]] = run_tracks.get(record["track"], 0) + record["ns"]
+            for track, ns in run_tracks.items():
+                tracks.setdefault(track, []).append(ns)
+        return {
+            "total_ns": statistics.median(totals),
+            "tracks_ns": {track: statistics.median(values) for track, values in tracks.items()}
+        }
+
+    def train(self, lib):
+        """Run the instrumented binary on its workload; the profile is written when it exits"""
+        target_name = f"{lib}_runtime_benchmark"
+        print(f"Training {target_name}...")
+        result = subprocess.run([str(self.runner.build_dir / target_name)], capture_output=True, text=True)
+        if result.returncode != 0:
+            print(f"Training run failed for {target_name}: {result.stderr}")
+            return False
+        return self.merge_clang_profile(target_name)
+
+    def merge_clang_profile(self, target_name):
+        """Clang writes raw profiles per process; -fprofile-instr-use wants them merged (nothing to do on GCC)"""
+        raw_profiles = sorted(glob.glob(str(self.profile_dir / f"{target_name}-*.profraw")))
+        if not raw_profiles:
+            return True
+        profdata = self.llvm_profdata or shutil.which("llvm-profdata") or \
+            next(iter(sorted(glob.glob("/usr/bin/llvm-profdata-*"), reverse=True)), None)
+        if not profdata:
+            print("llvm-profdata not found (pass --llvm-profdata), cannot merge the Clang profile")
+            return False
+        cmd = [profdata, "merge", f"-output={self.profile_dir / (target_name + '.profdata')}"] + raw_profiles
+        result = subprocess.run(cmd, capture_output=True, text=True)
+        if result.returncode != 0:
+            print(f"llvm-profdata merge failed for {target_name}: {result.stderr}")
+            return False
+        return True
+
+    def run(self):
+        # Profiles from an earlier run would be merged into (GCC) or mixed with (Clang) this one
+        if self.profile_dir.exists():
+            shutil.rmtree(self.profile_dir)
+        self.profile_dir.mkdir(parents=True)
+
+        print("\n--- Baseline (PGO_MODE=off) ---")
+        if not self.configure("off"):
+            return False
+        # The EASTL library is not instrumented; built up front so no step times it
+        subprocess.run(["cmake", "--build", str(self.runner.build_dir), "--target", "EASTL"], capture_output=True, text=True)
+        for lib in self.libraries:
+            built = self.build(lib)
+            runtime = self.measure_runtime(lib) if built else None
+            if not runtime:
+                return False
+            self.results[lib] = {"baseline": {"build_time": built[0], "binary_size": built[1], **runtime}}
+
+        print("\n--- Instrumented build and training (PGO_MODE=generate) ---")
+        if not self.configure("generate"):
+            return False
+        for lib in self.libraries:
+            built = self.build(lib)
+            if not built or not self.train(lib):
+                return False
+            self.results[lib]["instrumented"] = {"build_time": built[0], "binary_size": built[1]}
+
+        print("\n--- Optimized build (PGO_MODE=use) ---")
+        if not self.configure("use"):
+            return False
+        for lib in self.libraries:
+            built = self.build(lib)
+            runtime = self.measure_runtime(lib) if built else None
+            if not runtime:
+                return False
+            self.results[lib]["pgo"] = {"build_time": built[0], "binary_size": built[1], **runtime}
+            self.results[lib]["speedup"] = round(self.results[lib]["baseline"]["total_ns"] / runtime["total_ns"], 3)
+
+        # STL vs EASTL runtime ratio before and after; the gap narrows when it moves towards 1 on a log
+        # scale, so 0.5x and 2x count as the same gap
+        baseline_ratio = self.results["stl"]["baseline"]["total_ns"] / self.results["eastl"]["baseline"]["total_ns"]
+        pgo_ratio = self.results["stl"]["pgo"]["total_ns"] / self.results["eastl"]["pgo"]["total_ns"]
+        self.results["gap"] = {
+            "baseline_ratio": round(baseline_ratio, 3),
+            "pgo_ratio": round(pgo_ratio, 3),
+            "verdict": "narrows" if abs(math.log(pgo_ratio)) < abs(math.log(baseline_ratio)) else "widens"
+        }
+        return True
+
+    def result_lines(self):
+        lines = [f"PGO RESULTS ({self.build_type}, NUM_TYPES={self.results['num_types']}, median of {self.runs} runs)"]
+        lines.append("-" * 60)
+        for lib in self.libraries:
+            data = self.results[lib]
+            baseline, instrumented, pgo = data["baseline"], data["instrumented"], data["pgo"]
+            lines.append(f"{lib.upper()}:")
+            lines.append(f"  Build time:  baseline {baseline['build_time']:.3f}s, instrumented {instrumented['build_time']:.3f}s, "
+                         f"optimized {pgo['build_time']:.3f}s")
+            lines.append(f"  Binary size: baseline {baseline['binary_size'] / 1024:.2f} KB, instrumented {instrumented['binary_size'] / 1024:.2f} KB, "
+                         f"optimized {pgo['binary_size'] / 1024:.2f} KB")
+            lines.append(f"  Runtime:     baseline {baseline['total_ns'] / 1e6:.3f} ms, optimized {pgo['total_ns'] / 1e6:.3f} ms, "
+                         f"speedup {data['speedup']:.2f}x")
+            for track in sorted(pgo["tracks_ns"]):
+                base_ns = baseline["tracks_ns"].get(track)
+                speedup = f"{base_ns / pgo['tracks_ns'][track]:.2f}x" if base_ns and pgo["tracks_ns"][track] else "-"
+                lines.append(f"    {track:<12} speedup {speedup}")
+        gap = self.results["gap"]
+        lines.append(f"STL/EASTL runtime ratio: baseline {gap['baseline_ratio']:.2f}x, PGO {gap['pgo_ratio']:.2f}x "
+                     f"(PGO {gap['verdict']} the gap)")
+        return lines
+
+    def save_results(self):
+        timestamp = time.strftime("%Y%m%d_%H%M%S")
+        filename = self.runner.results_dir / f"pgo_results_{timestamp}.json"
+        with open(filename, 'w') as f:
+            json.dump(self.results, f, indent=2)
+        summary_file = self.runner.results_dir / f"pgo_summary_{timestamp}.txt"
+        with open(summary_file, 'w') as f:
+            f.write("\n".join(self.result_lines()) + "\n")
+        print(f"\nResults saved to: {filename}")
+        print(f"Summary saved to: {summary_file}")
+
+def main():
+    parser = argparse.ArgumentParser(description="STL vs EASTL profile-guided optimization benchmark")
+    parser.add_argument("--build-type", choices=["Debug", "Release", "RelWithDebInfo", "MinSizeRel"], default="Release",
+                       help="CMake build type of all three builds (default: Release)")
+    parser.add_argument("--num-types", type=int, default=100,
+                       help="Number of types to instantiate in benchmark (default: 100)")
+    parser.add_argument("--runs", type=int, default=3,
+                       help="Runtime benchmark runs per build, the median is reported (default: 3)")
+    parser.add_argument("--tracks", default=None,
+                       help="Comma-separated workload tracks to train and measure on top of the container workload")
+    parser.add_argument("--build-dir", default="build_pgo",
+                       help="Build directory shared by the three builds (default: build_pgo)")
+    parser.add_argument("--results-dir", default="results",
+                       help="Directory for the JSON results and summary (default: results)")
+    parser.add_argument("--llvm-profdata", default=None,
+                       help="llvm-profdata matching the Clang in use (default: from PATH)")
+    parser.add_argument("--clean", action="store_true",
+                       help="Clean build directory before running")
+
+    args = parser.parse_args()
+
+    cmake_options = {}
+    if args.tracks:
+        tracks = [t.strip() for t in args.tracks.split(",") if t.strip()]
+        unknown = [t for t in tracks if t not in SWEEP_DIMENSIONS["track"] or t == "none"]
+        if unknown:
+            parser.error(f"unknown track(s): {', '.join(unknown)}")
+        cmake_options["BENCHMARK_TRACKS"] = ";".join(tracks)
+
+    benchmark = PGOBenchmark(build_dir=args.build_dir, results_dir=args.results_dir, build_type=args.build_type,
+                             num_types=args.num_types, runs=args.runs, cmake_options=cmake_options,
+                             llvm_profdata=args.llvm_profdata)
+    if args.clean:
+        benchmark.runner.clean_build()
+
+    if not benchmark.run():
+        print("PGO benchmark failed!")
+        return 1
+
+    print()
+    for line in benchmark.result_lines():
+        print(line)
+    benchmark.save_results()
+    return 0
+
+if __name__ == "__main__":
+    exit(main())
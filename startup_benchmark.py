@@ -0,0 +1,259 @@
+#!/usr/bin/env python3
+"""
+Executable startup benchmark for the STL and EASTL binaries
+
+Each link configuration (dynamic/static runtime libraries x PIE on/off, the LINK_MODE and PIE CMake
+options) is built in its own directory, and every benchmark binary is then run many times with
+--startup-only, which prints its CLOCK_MONOTONIC time on entry to main() and returns. Time to main
+runs from just before the spawn to that stamp: fork + exec, mapping, dynamic loading and
+relocation, static initializers. The whole process (start to exit and wait4) is reported apart.
+
+Reported per binary:
+1. Time to main (median and minimum over --runs runs) and process start-to-exit time
+2. Page faults per run (minor and major, from wait4)
+3. Relocations: dynamic relocation entries in the executable (readelf -r), and for dynamic binaries
+   the relocations and cycles of the dynamic loader itself (glibc LD_DEBUG=statistics)
+4. Mapped size: PT_LOAD segments of the executable and of the shared libraries it loads (ldd)
+
+Usage: python3 startup_benchmark.py [--build-type Debug|Release|RelWithDebInfo|MinSizeRel] [--num-types N]
+       [--runs N] [--configs dynamic_pie,static_nopie,...] [--clean]
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+from benchmark import BenchmarkRunner
+
+# Link configurations: name -> CMake cache entries
+LINK_CONFIGS = {
+    "dynamic_pie": {"LINK_MODE": "dynamic", "PIE": "on"},
+    "dynamic_nopie": {"LINK_MODE": "dynamic", "PIE": "off"},
+    "static_pie": {"LINK_MODE": "static", "PIE": "on"},
+    "static_nopie": {"LINK_MODE": "static", "PIE": "off"}
+}
+
+STARTUP_TARGETS = ["stl_compilation_benchmark_test", "eastl_compilation_benchmark_test",
+                   "stl_runtime_benchmark", "eastl_runtime_benchmark"]
+
+def run_startup(binary):
+    """One --startup-only run: (seconds to main, seconds start to exit, minor faults, major faults).
+    time.monotonic_ns() reads the same CLOCK_MONOTONIC as the STARTUP_MAIN_NS stamp of the child"""
+    start_ns = time.monotonic_ns()
+    proc = subprocess.Popen([str(binary), "--startup-only"], stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    output = proc.stdout.read()
+    _, status, rusage = os.wait4(proc.pid, 0)
+    exit_ns = time.monotonic_ns()
+    proc.stdout.close()
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    match = re.search(rb"STARTUP_MAIN_NS (\d+)", output)
+    if proc.returncode != 0 or not match:
+        return None
+    return (int(match.group(1)) - start_ns) / 1e9, (exit_ns - start_ns) / 1e9, rusage.ru_minflt, rusage.ru_majflt
+
+def loaded_size(path):
+    """Bytes of the PT_LOAD segments of an ELF file (memory size, i.e. including .bss)"""
+    result = subprocess.run(["readelf", "-lW", str(path)], capture_output=True, text=True)
+    if result.returncode != 0:
+        return None
+    # LOAD  Offset VirtAddr PhysAddr FileSiz MemSiz Flg Align
+    return sum(int(fields[5], 16) for fields in (line.split() for line in result.stdout.splitlines())
+               if len(fields) >= 6 and fields[0] == "LOAD")
+
+def shared_libraries(binary):
+    """Paths of the shared libraries the dynamic loader maps for the binary (empty when static)"""
+    result = subprocess.run(["ldd", str(binary)], capture_output=True, text=True)
+    if result.returncode != 0:
+        return []
+    libraries = []
+    for line in result.stdout.splitlines():
+        match = re.search(r"(/\S+) \(0x", line)
+        if match:
+            libraries.append(match.group(1))
+    return libraries
+
+def relocation_entries(binary):
+    """Dynamic relocation entries in the executable (static-pie binaries relocate themselves)"""
+    result = subprocess.run(["readelf", "-rW", str(binary)], capture_output=True, text=True)
+    if result.returncode != 0:
+        return None
+    counts = [int(count) for count in re.findall(r"contains (\d+) (?:entry|entries)", result.stdout)]
+    return sum(counts)
+
+def loader_statistics(binary):
+    """glibc dynamic loader statistics of one run: relocations and startup cycles (None when static)"""
+    env = dict(os.environ, LD_DEBUG="statistics")
+    result = subprocess.run([str(binary), "--startup-only"], capture_output=True, text=True, env=env)
+    startup = re.search(r"total startup time in dynamic loader:\s*(\d+)", result.stderr)
+    relocations = re.search(r"final number of relocations:\s*(\d+)", result.stderr)
+    relative = re.search(r"number of relative relocations:\s*(\d+)", result.stderr)
+    if not startup:
+        return None
+    return {
+        "startup_cycles": int(startup.group(1)),
+        "relocations": int(relocations.group(1)) if relocations else None,
+        "relative_relocations": int(relative.group(1)) if relative else None
+    }
+
+class StartupBenchmark:
+    def __init__(self, build_root="build_startup", results_dir="results", build_types=["Debug", "Release"], num_types=100,
+                 runs=200, configs=None):
+        self.build_root = Path(build_root)
+        self.results_dir = Path(results_dir)
+        self.build_types = build_types
+        self.num_types = num_types
+        self.runs = runs
+        self.configs = configs or list(LINK_CONFIGS)
+        self.results = {}
+
+    def build(self, config, build_type):
+        """Configure and build every startup target of one link configuration; returns the build dir"""
+        self.build_root.mkdir(exist_ok=True)
+        runner = BenchmarkRunner(build_dir=self.build_root / f"{config}_{build_type}", results_dir=self.results_dir,
+                                 build_types=[build_type], enable_ftime_trace=False, num_types=self.num_types,
+                                 cmake_options=LINK_CONFIGS[config])
+        if not runner.run_cmake(build_type):
+            return None
+        for target in STARTUP_TARGETS:
+            print(f"Building {target} ({config}, {build_type})...")
+            result = subprocess.run(["cmake", "--build", str(runner.build_dir), "--target", target], capture_output=True, text=True)
+            if result.returncode != 0:
+                print(f"Build failed for {target}: {result.stderr}")
+                return None
+        return runner.build_dir
+
+    def measure(self, binary):
+        samples = []
+        for _ in range(self.runs):
+            sample = run_startup(binary)
+            if sample is None:
+                print(f"{binary.name} --startup-only failed")
+                return None
+            samples.append(sample)
+        times = [sample[0] for sample in samples]
+        process_times = [sample[1] for sample in samples]
+        libraries = shared_libraries(binary)
+        library_sizes = [loaded_size(library) or 0 for library in libraries]
+        executable_size = loaded_size(binary)
+        return {
+            "binary_size": binary.stat().st_size,
+            "time_to_main_us": round(statistics.median(times) * 1e6, 1),
+            "time_to_main_min_us": round(min(times) * 1e6, 1),
+            "process_time_us": round(statistics.median(process_times) * 1e6, 1),
+            "minor_faults": round(statistics.mean(sample[2] for sample in samples), 1),
+            "major_faults": round(statistics.mean(sample[3] for sample in samples), 2),
+            "relocation_entries": relocation_entries(binary),
+            "loader": loader_statistics(binary),
+            "mapped_bytes": executable_size,
+            "mapped_bytes_with_libraries": (executable_size or 0) + sum(library_sizes),
+            "shared_libraries": len(libraries)
+        }
+
+    def run(self):
+        for build_type in self.build_types:
+            for config in self.configs:
+                print(f"\n--- {config} ({build_type}) ---")
+                build_dir = self.build(config, build_type)
+                if build_dir is None:
+                    return False
+                point = self.results.setdefault(build_type, {}).setdefault(config, {})
+                for target in STARTUP_TARGETS:
+                    data = self.measure(build_dir / target)
+                    if data is None:
+                        return False
+                    point[target] = data
+                    print(f"  {target}: {data['time_to_main_us']} us to main, {data['minor_faults']} minor faults")
+        return True
+
+    def result_lines(self):
+        lines = []
+        for build_type, configs in self.results.items():
+            lines.append(f"STARTUP ({build_type}, median of {self.runs} runs)")
+            lines.append("-" * 60)
+            lines.append(f"{'Config':<14} {'Binary':<34} {'Size (KB)':<11} {'Main (us)':<10} {'Min (us)':<10} {'Exit (us)':<10} {'Faults':<8} "
+                         f"{'Relocs':<9} {'Loader relocs':<14} {'Mapped (KB)':<12} {'+libs (KB)':<11}")
+            for config, targets in configs.items():
+                for target, data in targets.items():
+                    loader = data["loader"] or {}
+                    loader_relocations = loader.get("relocations")
+                    lines.append(f"{config:<14} {target:<34} {data['binary_size'] / 1024:<11.1f} {data['time_to_main_us']:<10.1f} "
+                                 f"{data['time_to_main_min_us']:<10.1f} {data['process_time_us']:<10.1f} {data['minor_faults'] + data['major_faults']:<8.1f} "
+                                 f"{data['relocation_entries'] if data['relocation_entries'] is not None else '-':<9} "
+                                 f"{loader_relocations if loader_relocations is not None else '-':<14} "
+                                 f"{(data['mapped_bytes'] or 0) / 1024:<12.1f} {data['mapped_bytes_with_libraries'] / 1024:<11.1f}")
+            # STL vs EASTL per configuration: the size gap, and what it costs at startup
+            for config, targets in configs.items():
+                for kind in ["compilation_benchmark_test", "runtime_benchmark"]:
+                    stl, eastl = targets.get(f"stl_{kind}"), targets.get(f"eastl_{kind}")
+                    if stl and eastl and eastl["time_to_main_us"] > 0:
+                        lines.append(f"  {config} {kind}: STL/EASTL size {stl['binary_size'] / eastl['binary_size']:.2f}x, "
+                                     f"time to main {stl['time_to_main_us'] / eastl['time_to_main_us']:.2f}x")
+            lines.append("")
+        return lines
+
+    def save_results(self):
+        self.results_dir.mkdir(exist_ok=True)
+        timestamp = time.strftime("%Y%m%d_%H%M%S")
+        filename = self.results_dir / f"startup_results_{timestamp}.json"
+        with open(filename, 'w') as f:
+            json.dump(self.results, f, indent=2)
+        summary_file = self.results_dir / f"startup_summary_{timestamp}.txt"
+        with open(summary_file, 'w') as f:
+            f.write("\n".join(self.result_lines()) + "\n")
+        print(f"\nResults saved to: {filename}")
+        print(f"Summary saved to: {summary_file}")
+
+def main():
+    parser = argparse.ArgumentParser(description="STL vs EASTL executable startup benchmark")
+    parser.add_argument("--build-type", choices=["Debug", "Release", "RelWithDebInfo", "MinSizeRel"], default=None,
+                       help="Single CMake build type to test (default: both Debug and Release)")
+    parser.add_argument("--num-types", type=int, default=100,
+                       help="Number of types to instantiate in benchmark (default: 100)")
+    parser.add_argument("--runs", type=int, default=200,
+                       help="--startup-only runs per binary (default: 200)")
+    parser.add_argument("--configs", default=None,
+                       help="Comma-separated link configurations: " + ", ".join(LINK_CONFIGS) + " (default: all)")
+    parser.add_argument("--build-root", default="build_startup",
+                       help="Parent of the per-configuration build directories (default: build_startup)")
+    parser.add_argument("--results-dir", default="results",
+                       help="Directory for the JSON results and summary (default: results)")
+    parser.add_argument("--clean", action="store_true",
+                       help="Clean the build directories before running")
+
+    args = parser.parse_args()
+
+    if not sys.platform.startswith("linux"):
+        parser.error("the startup benchmark needs Linux (wait4 fault counts, readelf, ldd, glibc loader statistics)")
+
+    configs = None
+    if args.configs:
+        configs = [c.strip() for c in args.configs.split(",") if c.strip()]
+        unknown = [c for c in configs if c not in LINK_CONFIGS]
+        if unknown:
+            parser.error(f"unknown link configuration(s): {', '.join(unknown)}")
+
+    if args.clean and Path(args.build_root).exists():
+        shutil.rmtree(args.build_root)
+
+    benchmark = StartupBenchmark(build_root=args.build_root, results_dir=args.results_dir,
+                                 build_types=[args.build_type] if args.build_type else ["Debug", "Release"],
+                                 num_types=args.num_types, runs=args.runs, configs=configs)
+    if not benchmark.run():
+        print("Startup benchmark failed!")
+        return 1
+
+    print()
+    for line in benchmark.result_lines():
+        print(line)
+    benchmark.save_results()
+    return 0
+
+if __name__ == "__main__":
+    exit(main())
@@ -0,0 +1,150 @@
+#ifdef USE_STL
+// Counting replacements of the global operator new/delete for the STL runtime benchmark,
+// the STL counterpart of the counters behind the EASTL hooks in eastl_new.cpp
+// (benchmark/allocation_stats.h). Allocations themselves stay plain malloc/free.
+#include <new>
+#include <cstdlib>
+#include <cstdint>
+#include <mutex>
+#include "benchmark/allocation_stats.h"
+
+namespace {
+
+// Prefix of every allocation: sized delete is not guaranteed to be called, so the
+// requested size is kept here, together with the block start for over-aligned requests.
+// The slack reserved for the alignment is recorded as the alignment's log2, which covers
+// every power of two, so the free returns exactly the bytes the allocation reserved.
+struct AllocationHeader {
+    void* raw;                   // start of the malloc block
+    size_t requested : 58;       // bytes the container asked for
+    size_t alignment_shift : 6;  // log2 of the alignment, 0 when no slack was reserved
+};
+static_assert(sizeof(AllocationHeader) == 16, "header must keep the 16-byte alignment of the block");
+
+const size_t kBlockAlignment = 16;
+
+// Counters of the current thread (see allocation_stats.h)
+thread_local AllocationStats t_stats;
+
+// Totals of the threads merged so far. Blocks freed on another thread than the one that
+// allocated them leave live and reserved bytes off on both threads, which cancel out (unsigned
+// wrap-around) once both are added together
+AllocationStats g_merged_stats;
+std::mutex g_merged_mutex;
+
+void add_stats(AllocationStats& total, const AllocationStats& stats) {
+    total.allocations += stats.allocations;
+    total.deallocations += stats.deallocations;
+    total.bytes_requested += stats.bytes_requested;
+    total.live_bytes += stats.live_bytes;
+    total.peak_live_bytes += stats.peak_live_bytes;
+    total.reserved_bytes += stats.reserved_bytes;
+}
+
+// Extra bytes reserved to reach the alignment (1 << alignment_shift)
+size_t slack_bytes(size_t alignment_shift) {
+    return alignment_shift ? (size_t(1) << alignment_shift) - 1 : 0;
+}
+
+void* counted_allocate(size_t size, size_t alignment) {
+    if(alignment < kBlockAlignment) alignment = kBlockAlignment;
+
+    size_t alignment_shift = 0;
+    if(alignment > kBlockAlignment) {
+        while((size_t(1) << alignment_shift) < alignment) ++alignment_shift;
+    }
+    size_t bytes = sizeof(AllocationHeader) + size + slack_bytes(alignment_shift);
+    void* raw = malloc(bytes);
+    if(!raw) return nullptr;
+
+    uintptr_t user = ((uintptr_t)raw + sizeof(AllocationHeader) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    AllocationHeader* header = (AllocationHeader*)user - 1;
+    header->raw = raw;
+    header->requested = size;
+    header->alignment_shift = alignment_shift;
+
+    ++t_stats.allocations;
+    t_stats.bytes_requested += size;
+    t_stats.live_bytes += size;
+    if(t_stats.live_bytes > t_stats.peak_live_bytes) t_stats.peak_live_bytes = t_stats.live_bytes;
+    t_stats.reserved_bytes += bytes;
+    return (void*)user;
+}
+
+void counted_free(void* p) {
+    if(!p) return;
+    AllocationHeader* header = (AllocationHeader*)p - 1;
+    size_t requested = header->requested;
+    void* raw = header->raw;
+
+    ++t_stats.deallocations;
+    t_stats.live_bytes -= requested;
+    t_stats.reserved_bytes -= sizeof(AllocationHeader) + requested + slack_bytes(header->alignment_shift);
+    free(raw);
+}
+
+void* counted_allocate_or_throw(size_t size, size_t alignment) {
+    for(;;) {
+        void* p = counted_allocate(size, alignment);
+        if(p) return p;
+        std::new_handler handler = std::get_new_handler();
+        if(!handler) {
+#if defined(__cpp_exceptions)
+            throw std::bad_alloc();
+#else
+            abort();  // built with -fno-exceptions (ENABLE_EXCEPTIONS=OFF)
+#endif
+        }
+        handler();
+    }
+}
+
+}
+
+AllocationStats allocation_stats() {
+    return t_stats;
+}
+
+AllocationStats allocation_stats_total() {
+    std::lock_guard<std::mutex> lock(g_merged_mutex);
+    AllocationStats total = g_merged_stats;
+    add_stats(total, t_stats);
+    return total;
+}
+
+void allocation_stats_merge_thread() {
+    std::lock_guard<std::mutex> lock(g_merged_mutex);
+    add_stats(g_merged_stats, t_stats);
+    t_stats = AllocationStats();
+}
+
+void reset_peak_live_bytes() {
+    t_stats.peak_live_bytes = t_stats.live_bytes;
+}
+
+const char* allocation_backend_name() {
+    return "malloc";
+}
+
+void* operator new(size_t size) { return counted_allocate_or_throw(size, kBlockAlignment); }
+void* operator new[](size_t size) { return counted_allocate_or_throw(size, kBlockAlignment); }
+void* operator new(size_t size, std::align_val_t alignment) { return counted_allocate_or_throw(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return counted_allocate_or_throw(size, (size_t)alignment); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return counted_allocate(size, kBlockAlignment); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return counted_allocate(size, kBlockAlignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return counted_allocate(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return counted_allocate(size, (size_t)alignment); }
+
+void operator delete(void* p) noexcept { counted_free(p); }
+void operator delete[](void* p) noexcept { counted_free(p); }
+void operator delete(void* p, size_t) noexcept { counted_free(p); }
+void operator delete[](void* p, size_t) noexcept { counted_free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { counted_free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { counted_free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { counted_free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { counted_free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { counted_free(p); }
+#endif